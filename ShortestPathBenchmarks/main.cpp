@@ -0,0 +1,1144 @@
+#include "AStar.h"
+#include "BatchQueryRunner.h"
+#include "BidirectionalSearch.h"
+#include "BitboardBreadthFirstSearch.h"
+#include "BreadthFirstSearch.h"
+#include "BucketQueue.h"
+#include "ClusterAbstraction.h"
+#include "ContractionHierarchy.h"
+#include "ContractionHierarchyQuery.h"
+#include "DaryHeap.h"
+#include "Dijkstra.h"
+#include "DStarLite.h"
+#include "Graph.h"
+#include "GraphBuilder.h"
+#include "GridGraph.h"
+#include "HierarchicalAStar.h"
+#include "IShortestPathStrategy.h"
+#include "JumpPointSearch.h"
+#include "JumpPointTable.h"
+#include "Landmarks.h"
+#include "MinHeapQueue.h"
+#include "QueryRunner.h"
+#include "RadixHeap.h"
+#include "SearchContext.h"
+#include "SearchPolicies.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <random>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/************  TYPES  *****************/
+
+// one line of the JSON report, every record has the same keys so runs of different releases can be diffed
+struct BenchmarkRecord {
+	// "group/subject/variant", e.g. "search/astar/maze"
+	std::string name;
+	// elements in the queue or cells of the grid
+	long long size;
+	int runs;
+	// best of the runs
+	double milliseconds;
+	// operations, cells built, nodes expanded or queries run by one run
+	// (records with 0 milliseconds only count something: bytes, shortcuts, path lengths...)
+	long long items;
+};
+
+// benchmark_strategy builds every strategy from (graph, capacity)
+class EightConnectedJumpPointSearch :
+	public JumpPointSearch
+{
+public:
+	EightConnectedJumpPointSearch(std::shared_ptr<const GridGraph> graph, size_t capacity) :
+		JumpPointSearch(graph, capacity, GridMovement::EightConnected) {
+	}
+};
+
+/**********  END TYPES  ***************/
+
+/************  FUNCTIONS  ***************/
+
+// insert all, decrease every other key, pop all: one record per operation
+template<class PriorityQueue>
+void benchmark_queue(const std::string& name, int size, std::vector<BenchmarkRecord>& records);
+
+// a GridGraph set up cell by cell like the visualizer does when tiles are edited
+void benchmark_grid_graph_construction(int side, std::vector<BenchmarkRecord>& records);
+// a CSR Graph from nodes and adjacency lists, the way initializeGraph built the graph of the grid
+void benchmark_graph_construction(int side, std::vector<BenchmarkRecord>& records);
+
+// corner to corner on a context shared by every search of the map, items are the expanded nodes
+template<class Search>
+void benchmark_search(const std::string& name, std::shared_ptr<GridGraph> graph, typename Search::Context& context,
+	std::vector<BenchmarkRecord>& records);
+// corner to corner with a strategy built from (graph, capacity) like the visualizer builds them, items are the expanded nodes
+template<class Strategy>
+void benchmark_strategy(const std::string& name, std::shared_ptr<GridGraph> graph, std::vector<BenchmarkRecord>& records);
+// the same batch of A* queries on 1, 2, 4... threads up to one per core, items are the queries
+void benchmark_batch(int side, int queryCount, std::vector<BenchmarkRecord>& records);
+
+// the same search run with solve() or calling step() through IShortestPathStrategy until -1 (like the visualizer),
+// items are the expanded nodes
+template<class Strategy>
+void benchmark_solve(const std::string& name, std::shared_ptr<GridGraph> graph, std::vector<BenchmarkRecord>& records);
+// benchmark_search on a context of its own, and the bytes of that context
+template<class Search>
+void benchmark_context_size(const std::string& name, std::shared_ptr<GridGraph> graph, std::vector<BenchmarkRecord>& records);
+// A* against jump point search and JPS+ (with the build time and bytes of the table) in both movements
+void benchmark_jump_point(int side, int obstaclePercent, std::vector<BenchmarkRecord>& records);
+// A* with landmarkCount landmarks (plain A* for 0), the preprocessing time and the bytes of the landmarks
+void benchmark_landmarks(const std::string& name, std::shared_ptr<GridGraph> graph, int landmarkCount, LandmarkSelection selection,
+	std::vector<BenchmarkRecord>& records);
+// contracts a random grid (time and shortcuts added) and random queries on it against online searches
+void benchmark_contraction_hierarchy(int side, std::vector<BenchmarkRecord>& records);
+// builds the HPA* clusters of a random grid for every cluster size: random queries, the length of their paths
+// against the optimal ones and the update after a tile changes
+void benchmark_hierarchical_astar(int side, const std::vector<int>& clusterSizes, std::vector<BenchmarkRecord>& records);
+// random queries on a grid before (flat) and after 30% of its tiles get terrain costs (2 to 8):
+// unit cost searches against the weighted ones on the same unweighted grid, then the weighted ones on terrain
+void benchmark_terrain(int side, int queryCount, std::vector<BenchmarkRecord>& records);
+// an agent walks the D* Lite path and a tile of the path ahead of it gets blocked every few steps:
+// replanning time and expansions against searching again with A* from where the agent is
+void benchmark_dstar_lite(int side, int replans, std::vector<BenchmarkRecord>& records);
+// short queries (the end a few tiles from the start): a new A* per query against A* on one reused SearchContext
+void benchmark_search_context(int side, int queryCount, std::vector<BenchmarkRecord>& records);
+// every cell reachable from a corner with BreadthFirstSearch and BitboardBreadthFirstSearch, items are the cells
+void benchmark_distance_field(int side, std::vector<BenchmarkRecord>& records);
+
+// per query records: runs are the queries, milliseconds the average of a query and items 1
+template<class Strategy>
+BenchmarkRecord measure_queries(const std::string& name, std::shared_ptr<GridGraph> graph, const std::vector<std::pair<int, int>>& queries);
+BenchmarkRecord measure_queries(const std::string& name, std::shared_ptr<GridGraph> graph, std::shared_ptr<const ContractionHierarchy> hierarchy,
+	const std::vector<std::pair<int, int>>& queries);
+BenchmarkRecord measure_queries(const std::string& name, std::shared_ptr<GridGraph> graph, SearchContext<BucketQueue>& context,
+	const std::vector<std::pair<int, int>>& queries);
+
+// true if a side x side grid is within maxCells
+bool fits(int side, long long maxCells);
+std::shared_ptr<GridGraph> createOpenGrid(int side);
+std::shared_ptr<GridGraph> createRandomGrid(int side, int obstaclePercent);
+// a perfect maze carved by a randomized depth first search: rooms on the odd cells, walls between them
+std::shared_ptr<GridGraph> createMaze(int side);
+// true for the blocked cells, obstaclePercent of them at random
+std::vector<bool> createObstacles(int side, int obstaclePercent);
+// between random free cells of graph
+std::vector<GridQuery> createQueries(const GridGraph& graph, int count);
+// createQueries as (start, end) node pairs
+std::vector<std::pair<int, int>> createNodeQueries(const GridGraph& graph, int count);
+// horizontal walls every few rows with the gap on alternate ends, the Manhattan distance is useless there
+std::shared_ptr<GridGraph> createSerpentineGrid(int side);
+
+// large sizes run once, a single run of them is long enough to be stable
+int runsFor(long long size);
+double keepBest(double best, double milliseconds, int run);
+double elapsedMilliseconds(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end);
+BenchmarkRecord makeRecord(const std::string& name, long long size, int runs, double milliseconds, long long items);
+
+void writeJson(std::ostream& output, long long maxCells, const std::vector<BenchmarkRecord>& records);
+void printUsage();
+
+/**********  END FUNCTIONS  *************/
+
+// version of the JSON layout, bumped when keys are renamed or removed
+const int schemaVersion = 1;
+const long long defaultMaxCells = 10000000;
+// the adjacency lists of GraphBuilder take more than 100 bytes per cell
+const long long maxAdjacencyListCells = 10000000;
+
+// ShortestPathBenchmarks [--max-cells n]
+// Times, for sizes from 1K to 100M elements or cells (up to --max-cells, 10M by default):
+//	- MinHeap (behind MinHeapQueue), DaryHeap<2>, DaryHeap<4>, DaryHeap<8> and RadixHeap insert, decreaseKey and pop throughput
+//	- construction cost per cell of a GridGraph and of an initializeGraph style CSR Graph
+//	- Dijkstra and A* expanded nodes per second on open grids, 20% random obstacles and mazes
+//	- Dijkstra, A* and the bidirectional searches with every queue, and BreadthFirstSearch, on 20% random obstacles
+//	- queries per second of a batch of 1000 A* queries on 1, 2, 4... threads (100K cells, 20% obstacles)
+//	- solve() against calling step() for every node
+//	- jump point search and JPS+ against A* on open and cluttered grids
+//	- A* with ALT landmarks against the Manhattan distance on a serpentine map
+//	- contraction hierarchies and HPA* clusters: preprocessing and query latency against online searches
+//	- float against integer costs and 4-connected against 8-connected: expansion rate and memory of the search state
+//	- query latency of the weighted searches with and without terrain costs
+//	- D* Lite replanning after tiles change against a new A* search
+//	- short queries with and without a reused SearchContext
+//	- full distance fields with BreadthFirstSearch and BitboardBreadthFirstSearch
+// and writes the results as JSON to the standard output, progress goes to the standard error.
+// Sizes up to 1M are the best of 3 runs, larger ones a single run.
+// Build in release mode, numbers in debug mode are meaningless (the report says which build made it).
+int main(int argc, char** argv) {
+	long long maxCells = defaultMaxCells;
+	if (argc == 3 && std::string(argv[1]) == "--max-cells") {
+		maxCells = std::atoll(argv[2]);
+	}
+	if ((argc != 1 && argc != 3) || maxCells <= 0) {
+		printUsage();
+		return 1;
+	}
+
+	std::vector<BenchmarkRecord> records;
+
+	for (int size : { 1000, 100000, 1000000, 10000000 }) {
+		if (size > maxCells) {
+			break;
+		}
+		std::cerr << "queues, " << size << " elements" << std::endl;
+		benchmark_queue<MinHeapQueue>("queue/min_heap", size, records);
+		benchmark_queue<DaryHeap<2>>("queue/dary_heap_2", size, records);
+		benchmark_queue<DaryHeap<4>>("queue/dary_heap_4", size, records);
+		benchmark_queue<DaryHeap<8>>("queue/dary_heap_8", size, records);
+		benchmark_queue<RadixHeap>("queue/radix_heap", size, records);
+	}
+
+	// 1K, 10K, 100K, 1M, 10M and 100M cells
+	const std::vector<int> sides = { 32, 100, 316, 1000, 3162, 10000 };
+	for (int side : sides) {
+		long long cells = static_cast<long long>(side) * side;
+		if (cells > maxCells) {
+			break;
+		}
+		std::cerr << "construction, " << cells << " cells" << std::endl;
+		benchmark_grid_graph_construction(side, records);
+		if (cells <= maxAdjacencyListCells) {
+			benchmark_graph_construction(side, records);
+		}
+	}
+
+	for (int side : sides) {
+		long long cells = static_cast<long long>(side) * side;
+		if (cells > maxCells) {
+			break;
+		}
+		std::cerr << "searches, " << cells << " cells" << std::endl;
+		SearchContext<DaryHeap<4>> context(static_cast<size_t>(cells));
+
+		std::shared_ptr<GridGraph> graph = createOpenGrid(side);
+		benchmark_search<GridDijkstra<>>("search/dijkstra/open", graph, context, records);
+		benchmark_search<GridAStar<>>("search/astar/open", graph, context, records);
+
+		graph = createRandomGrid(side, 20);
+		benchmark_search<GridDijkstra<>>("search/dijkstra/random", graph, context, records);
+		benchmark_search<GridAStar<>>("search/astar/random", graph, context, records);
+
+		graph = createMaze(side);
+		benchmark_search<GridDijkstra<>>("search/dijkstra/maze", graph, context, records);
+		benchmark_search<GridAStar<>>("search/astar/maze", graph, context, records);
+	}
+
+	for (int side : { 100, 512, 2048 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "queues in searches, " << side * side << " cells" << std::endl;
+		std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+		benchmark_strategy<Dijkstra<DaryHeap<2>>>("queue_search/dijkstra/dary_heap_2", graph, records);
+		benchmark_strategy<Dijkstra<DaryHeap<4>>>("queue_search/dijkstra/dary_heap_4", graph, records);
+		benchmark_strategy<Dijkstra<DaryHeap<8>>>("queue_search/dijkstra/dary_heap_8", graph, records);
+		benchmark_strategy<Dijkstra<MinHeapQueue>>("queue_search/dijkstra/min_heap", graph, records);
+		benchmark_strategy<Dijkstra<BucketQueue>>("queue_search/dijkstra/bucket_queue", graph, records);
+		benchmark_strategy<Dijkstra<RadixHeap>>("queue_search/dijkstra/radix_heap", graph, records);
+		benchmark_strategy<BreadthFirstSearch>("queue_search/breadth_first/ring_buffer", graph, records);
+		benchmark_strategy<AStar<DaryHeap<2>>>("queue_search/astar/dary_heap_2", graph, records);
+		benchmark_strategy<AStar<DaryHeap<4>>>("queue_search/astar/dary_heap_4", graph, records);
+		benchmark_strategy<AStar<DaryHeap<8>>>("queue_search/astar/dary_heap_8", graph, records);
+		benchmark_strategy<AStar<MinHeapQueue>>("queue_search/astar/min_heap", graph, records);
+		benchmark_strategy<AStar<BucketQueue>>("queue_search/astar/bucket_queue", graph, records);
+		benchmark_strategy<AStar<RadixHeap>>("queue_search/astar/radix_heap", graph, records);
+		benchmark_strategy<BidirectionalDijkstra<BucketQueue>>("queue_search/bidirectional_dijkstra/bucket_queue", graph, records);
+		benchmark_strategy<BidirectionalAStar<BucketQueue>>("queue_search/bidirectional_astar/bucket_queue", graph, records);
+	}
+
+	const int batchSide = 316;
+	if (fits(batchSide, maxCells)) {
+		std::cerr << "batches, " << batchSide * batchSide << " cells" << std::endl;
+		benchmark_batch(batchSide, 1000, records);
+	}
+
+	for (int side : { 512, 2048 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "solve() against step(), " << side * side << " cells" << std::endl;
+		std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+		benchmark_solve<Dijkstra<BucketQueue>>("solve/dijkstra_bucket_queue", graph, records);
+		benchmark_solve<AStar<BucketQueue>>("solve/astar_bucket_queue", graph, records);
+	}
+
+	for (int obstaclePercent : { 0, 5, 20 }) {
+		for (int side : { 512, 2048 }) {
+			if (!fits(side, maxCells)) {
+				break;
+			}
+			std::cerr << "jump point search, " << side * side << " cells, " << obstaclePercent << "% obstacles" << std::endl;
+			benchmark_jump_point(side, obstaclePercent, records);
+		}
+	}
+
+	for (int side : { 512, 2048 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "landmarks, " << side * side << " cells" << std::endl;
+		std::shared_ptr<GridGraph> graph = createSerpentineGrid(side);
+		benchmark_landmarks("landmarks/astar", graph, 0, LandmarkSelection::Farthest, records);
+		benchmark_landmarks("landmarks/alt_4_farthest", graph, 4, LandmarkSelection::Farthest, records);
+		benchmark_landmarks("landmarks/alt_8_farthest", graph, 8, LandmarkSelection::Farthest, records);
+		benchmark_landmarks("landmarks/alt_16_farthest", graph, 16, LandmarkSelection::Farthest, records);
+		benchmark_landmarks("landmarks/alt_8_avoid", graph, 8, LandmarkSelection::Avoid, records);
+	}
+
+	for (int side : { 128, 256 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "contraction hierarchies, " << side * side << " cells" << std::endl;
+		benchmark_contraction_hierarchy(side, records);
+	}
+
+	for (int side : { 512, 1024 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "HPA*, " << side * side << " cells" << std::endl;
+		benchmark_hierarchical_astar(side, { 16, 32 }, records);
+	}
+
+	for (int side : { 2048, 4096 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "cost types, " << side * side << " cells" << std::endl;
+		std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+		benchmark_context_size<Dijkstra<DaryHeap<4>>>("cost_type/dijkstra_dary_heap_4_float", graph, records);
+		benchmark_context_size<IntegerDijkstra<DaryHeap<4, uint32_t>>>("cost_type/dijkstra_dary_heap_4_uint32", graph, records);
+		benchmark_context_size<Dijkstra<BucketQueue>>("cost_type/dijkstra_bucket_queue_float", graph, records);
+		benchmark_context_size<IntegerDijkstra<BucketQueue>>("cost_type/dijkstra_bucket_queue_uint32", graph, records);
+		benchmark_context_size<IntegerDijkstra<BucketQueue, uint16_t>>("cost_type/dijkstra_bucket_queue_uint16", graph, records);
+		benchmark_context_size<AStar<BucketQueue>>("cost_type/astar_bucket_queue_float", graph, records);
+		benchmark_context_size<IntegerAStar<BucketQueue>>("cost_type/astar_bucket_queue_uint32", graph, records);
+		benchmark_context_size<IntegerAStar<BucketQueue, uint16_t>>("cost_type/astar_bucket_queue_uint16", graph, records);
+	}
+
+	for (int side : { 1024, 2048 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "4-connected against 8-connected, " << side * side << " cells" << std::endl;
+		std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+		benchmark_context_size<GridDijkstra<>>("movement/dijkstra_4_connected", graph, records);
+		benchmark_context_size<OctileDijkstra<>>("movement/dijkstra_8_connected", graph, records);
+		benchmark_context_size<OctileDijkstra<DaryHeap<4>, CornerCutting::Always>>("movement/dijkstra_8_connected_cutting", graph, records);
+		benchmark_context_size<GridAStar<>>("movement/astar_4_connected", graph, records);
+		benchmark_context_size<OctileAStar<>>("movement/astar_8_connected", graph, records);
+		benchmark_context_size<OctileAStar<DaryHeap<4>, CornerCutting::Always>>("movement/astar_8_connected_cutting", graph, records);
+	}
+
+	for (int side : { 256, 1024 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "terrain costs, " << side * side << " cells" << std::endl;
+		benchmark_terrain(side, 50, records);
+	}
+
+	for (int side : { 512, 2048 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "D* Lite, " << side * side << " cells" << std::endl;
+		benchmark_dstar_lite(side, 20, records);
+	}
+
+	for (int side : { 512, 2048 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "short queries, " << side * side << " cells" << std::endl;
+		benchmark_search_context(side, 1000, records);
+	}
+
+	for (int side : { 512, 2048, 4096 }) {
+		if (!fits(side, maxCells)) {
+			break;
+		}
+		std::cerr << "distance fields, " << side * side << " cells" << std::endl;
+		benchmark_distance_field(side, records);
+	}
+
+	writeJson(std::cout, maxCells, records);
+	return 0;
+}
+
+template<class PriorityQueue>
+void benchmark_queue(const std::string& name, int size, std::vector<BenchmarkRecord>& records) {
+	std::mt19937 random(1);
+	std::uniform_int_distribution<int> keys(1000, 1000000);
+
+	std::vector<float> initialKeys(size);
+	for (auto& key : initialKeys) {
+		key = static_cast<float>(keys(random));
+	}
+
+	int runs = runsFor(size);
+	double insert = 0.0;
+	double decrease = 0.0;
+	double pop = 0.0;
+	for (int run = 0; run < runs; ++run) {
+		PriorityQueue queue(size);
+
+		auto begin = std::chrono::steady_clock::now();
+		for (int node = 0; node < size; ++node) {
+			queue.insert(node, initialKeys[node]);
+		}
+		auto inserted = std::chrono::steady_clock::now();
+		for (int node = 0; node < size; node += 2) {
+			queue.decreaseKey(node, initialKeys[node] - 1000.0f);
+		}
+		auto decreased = std::chrono::steady_clock::now();
+		while (!queue.isEmpty()) {
+			queue.pop();
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		insert = keepBest(insert, elapsedMilliseconds(begin, inserted), run);
+		decrease = keepBest(decrease, elapsedMilliseconds(inserted, decreased), run);
+		pop = keepBest(pop, elapsedMilliseconds(decreased, end), run);
+	}
+
+	records.push_back(makeRecord(name + "/insert", size, runs, insert, size));
+	records.push_back(makeRecord(name + "/decrease_key", size, runs, decrease, (size + 1) / 2));
+	records.push_back(makeRecord(name + "/pop", size, runs, pop, size));
+}
+
+void benchmark_grid_graph_construction(int side, std::vector<BenchmarkRecord>& records) {
+	std::vector<bool> blocked = createObstacles(side, 20);
+	long long cells = static_cast<long long>(side) * side;
+
+	int runs = runsFor(cells);
+	double best = 0.0;
+	for (int run = 0; run < runs; ++run) {
+		auto begin = std::chrono::steady_clock::now();
+
+		auto graph = std::make_shared<GridGraph>(side, side);
+		for (int y = 0; y < side; ++y) {
+			for (int x = 0; x < side; ++x) {
+				graph->setBlocked(x, y, blocked[graph->index(x, y)]);
+			}
+		}
+
+		auto end = std::chrono::steady_clock::now();
+		best = keepBest(best, elapsedMilliseconds(begin, end), run);
+	}
+
+	records.push_back(makeRecord("construction/grid_graph", cells, runs, best, cells));
+}
+
+void benchmark_graph_construction(int side, std::vector<BenchmarkRecord>& records) {
+	std::vector<bool> blocked = createObstacles(side, 20);
+	long long cells = static_cast<long long>(side) * side;
+	auto isFree = [&blocked, side](int x, int y) {
+		return x >= 0 && x < side && y >= 0 && y < side && !blocked[y * side + x];
+	};
+
+	int runs = runsFor(cells);
+	double best = 0.0;
+	for (int run = 0; run < runs; ++run) {
+		auto begin = std::chrono::steady_clock::now();
+
+		GraphBuilder builder(side * side);
+		for (int y = 0; y < side; ++y) {
+			for (int x = 0; x < side; ++x) {
+				int index = static_cast<int>(builder.nodes().size());
+				Graph::Node node = { index, x, y, -1 };
+				builder.nodes().push_back(node);
+				builder.adjacencyList().push_back(std::list<int>());
+				if (!isFree(x, y)) {
+					continue;
+				}
+
+				// top, bottom, left and right like initializeGraph
+				std::list<int>& adjacent = builder.adjacencyList()[index];
+				if (isFree(x, y - 1)) {
+					adjacent.push_back(index - side);
+				}
+				if (isFree(x, y + 1)) {
+					adjacent.push_back(index + side);
+				}
+				if (isFree(x - 1, y)) {
+					adjacent.push_back(index - 1);
+				}
+				if (isFree(x + 1, y)) {
+					adjacent.push_back(index + 1);
+				}
+			}
+		}
+		std::shared_ptr<Graph> graph = builder.build();
+
+		auto end = std::chrono::steady_clock::now();
+		best = keepBest(best, elapsedMilliseconds(begin, end), run);
+	}
+
+	records.push_back(makeRecord("construction/csr_graph", cells, runs, best, cells));
+}
+
+template<class Search>
+void benchmark_search(const std::string& name, std::shared_ptr<GridGraph> graph, typename Search::Context& context,
+	std::vector<BenchmarkRecord>& records) {
+	long long cells = graph->numberOfNodes();
+
+	int runs = runsFor(cells);
+	double best = 0.0;
+	long long expansions = 0;
+	for (int run = 0; run < runs; ++run) {
+		auto begin = std::chrono::steady_clock::now();
+
+		Search search(graph, context);
+		expansions = 0;
+		while (search.step() != -1) {
+			++expansions;
+		}
+
+		auto end = std::chrono::steady_clock::now();
+		best = keepBest(best, elapsedMilliseconds(begin, end), run);
+	}
+
+	records.push_back(makeRecord(name, cells, runs, best, expansions));
+}
+
+template<class Strategy>
+void benchmark_strategy(const std::string& name, std::shared_ptr<GridGraph> graph, std::vector<BenchmarkRecord>& records) {
+	long long cells = graph->numberOfNodes();
+
+	int runs = runsFor(cells);
+	double best = 0.0;
+	long long expansions = 0;
+	for (int run = 0; run < runs; ++run) {
+		auto begin = std::chrono::steady_clock::now();
+
+		Strategy strategy(graph, graph->numberOfNodes());
+		expansions = 0;
+		while (strategy.step() != -1) {
+			++expansions;
+		}
+
+		auto end = std::chrono::steady_clock::now();
+		best = keepBest(best, elapsedMilliseconds(begin, end), run);
+	}
+
+	records.push_back(makeRecord(name, cells, runs, best, expansions));
+}
+
+void benchmark_batch(int side, int queryCount, std::vector<BenchmarkRecord>& records) {
+	std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+	std::vector<GridQuery> queries = createQueries(*graph, queryCount);
+	long long cells = graph->numberOfNodes();
+
+	unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+	std::vector<unsigned int> threadCounts;
+	for (unsigned int threads = 1; threads < cores; threads *= 2) {
+		threadCounts.push_back(threads);
+	}
+	threadCounts.push_back(cores);
+
+	for (unsigned int threads : threadCounts) {
+		// the threads are started once, like a server would keep them
+		BatchQueryRunner runner(graph, ShortestPathAlgorithm::AStar, threads);
+
+		int runs = runsFor(cells);
+		double best = 0.0;
+		for (int run = 0; run < runs; ++run) {
+			auto begin = std::chrono::steady_clock::now();
+			runner.run(queries);
+			auto end = std::chrono::steady_clock::now();
+			best = keepBest(best, elapsedMilliseconds(begin, end), run);
+		}
+
+		records.push_back(makeRecord("batch/astar/threads_" + std::to_string(threads), cells, runs, best, queries.size()));
+	}
+}
+
+template<class Strategy>
+void benchmark_solve(const std::string& name, std::shared_ptr<GridGraph> graph, std::vector<BenchmarkRecord>& records) {
+	long long cells = graph->numberOfNodes();
+
+	int runs = runsFor(cells);
+	double stepBest = 0.0;
+	double solveBest = 0.0;
+	long long expansions = 0;
+	for (int run = 0; run < runs; ++run) {
+		auto begin = std::chrono::steady_clock::now();
+
+		Strategy stepped(graph, graph->numberOfNodes());
+		IShortestPathStrategy& animated = stepped;
+		expansions = 0;
+		while (animated.step() != -1) {
+			++expansions;
+		}
+
+		auto stepEnd = std::chrono::steady_clock::now();
+
+		Strategy solved(graph, graph->numberOfNodes());
+		solved.solve();
+
+		auto end = std::chrono::steady_clock::now();
+		stepBest = keepBest(stepBest, elapsedMilliseconds(begin, stepEnd), run);
+		solveBest = keepBest(solveBest, elapsedMilliseconds(stepEnd, end), run);
+	}
+
+	// both expand the same nodes
+	records.push_back(makeRecord(name + "/step", cells, runs, stepBest, expansions));
+	records.push_back(makeRecord(name + "/solve", cells, runs, solveBest, expansions));
+}
+
+template<class Search>
+void benchmark_context_size(const std::string& name, std::shared_ptr<GridGraph> graph, std::vector<BenchmarkRecord>& records) {
+	typename Search::Context context(graph->numberOfNodes());
+	benchmark_search<Search>(name + "/search", graph, context, records);
+
+	long long bytes = static_cast<long long>(Search::Context::bytesPerNode()) * graph->numberOfNodes();
+	records.push_back(makeRecord(name + "/context_bytes", graph->numberOfNodes(), 1, 0.0, bytes));
+}
+
+void benchmark_jump_point(int side, int obstaclePercent, std::vector<BenchmarkRecord>& records) {
+	std::shared_ptr<GridGraph> graph = createRandomGrid(side, obstaclePercent);
+	long long cells = graph->numberOfNodes();
+	std::string obstacles = "/obstacles_" + std::to_string(obstaclePercent);
+
+	benchmark_strategy<AStar<BucketQueue>>("jump_point/astar_bucket_queue" + obstacles, graph, records);
+	benchmark_strategy<JumpPointSearch>("jump_point/jps_4_connected" + obstacles, graph, records);
+	benchmark_strategy<EightConnectedJumpPointSearch>("jump_point/jps_8_connected" + obstacles, graph, records);
+
+	for (GridMovement movement : { GridMovement::FourConnected, GridMovement::EightConnected }) {
+		std::string name = movement == GridMovement::FourConnected ? "jump_point/jps_plus_4_connected" : "jump_point/jps_plus_8_connected";
+		// the table is built once per map, the queries reuse it
+		auto table = std::make_shared<JumpPointTable>(graph, movement);
+
+		int runs = runsFor(cells);
+		double best = 0.0;
+		long long expansions = 0;
+		for (int run = 0; run < runs; ++run) {
+			auto begin = std::chrono::steady_clock::now();
+
+			JumpPointSearch search(graph, table, graph->numberOfNodes());
+			expansions = 0;
+			while (search.step() != -1) {
+				++expansions;
+			}
+
+			auto end = std::chrono::steady_clock::now();
+			best = keepBest(best, elapsedMilliseconds(begin, end), run);
+		}
+
+		records.push_back(makeRecord(name + obstacles, cells, runs, best, expansions));
+		records.push_back(makeRecord(name + "_table_build" + obstacles, cells, 1, table->buildMilliseconds(), cells));
+		records.push_back(makeRecord(name + "_table_bytes" + obstacles, cells, 1, 0.0, table->sizeInBytes()));
+	}
+}
+
+void benchmark_landmarks(const std::string& name, std::shared_ptr<GridGraph> graph, int landmarkCount, LandmarkSelection selection,
+	std::vector<BenchmarkRecord>& records) {
+	long long cells = graph->numberOfNodes();
+	std::shared_ptr<Landmarks> landmarks;
+	if (landmarkCount > 0) {
+		landmarks = std::make_shared<Landmarks>(graph, landmarkCount, selection);
+	}
+
+	int runs = runsFor(cells);
+	double best = 0.0;
+	long long expansions = 0;
+	for (int run = 0; run < runs; ++run) {
+		auto begin = std::chrono::steady_clock::now();
+
+		std::unique_ptr<AStar<BucketQueue>> search(landmarks != nullptr ?
+			new AStar<BucketQueue>(graph, graph->numberOfNodes(), ManhattanHeuristic(landmarks)) :
+			new AStar<BucketQueue>(graph, graph->numberOfNodes()));
+		expansions = 0;
+		while (search->step() != -1) {
+			++expansions;
+		}
+
+		auto end = std::chrono::steady_clock::now();
+		best = keepBest(best, elapsedMilliseconds(begin, end), run);
+	}
+
+	records.push_back(makeRecord(name + "/search", cells, runs, best, expansions));
+	if (landmarks != nullptr) {
+		// items are the landmarks, one full search each
+		records.push_back(makeRecord(name + "/build", cells, 1, landmarks->buildMilliseconds(), landmarkCount));
+		records.push_back(makeRecord(name + "/bytes", cells, 1, 0.0, landmarks->sizeInBytes()));
+	}
+}
+
+void benchmark_contraction_hierarchy(int side, std::vector<BenchmarkRecord>& records) {
+	std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+	long long cells = graph->numberOfNodes();
+	auto hierarchy = std::make_shared<ContractionHierarchy>(graph);
+	std::vector<std::pair<int, int>> queries = createNodeQueries(*graph, 200);
+
+	records.push_back(makeRecord("contraction/hierarchy/build", cells, 1, hierarchy->buildMilliseconds(), cells));
+	records.push_back(makeRecord("contraction/hierarchy/shortcuts", cells, 1, 0.0, hierarchy->numberOfShortcuts()));
+	records.push_back(measure_queries("contraction/hierarchy/query", graph, hierarchy, queries));
+	records.push_back(measure_queries<BidirectionalDijkstra<BucketQueue>>("contraction/bidirectional_dijkstra/query", graph, queries));
+	records.push_back(measure_queries<AStar<BucketQueue>>("contraction/astar/query", graph, queries));
+}
+
+void benchmark_hierarchical_astar(int side, const std::vector<int>& clusterSizes, std::vector<BenchmarkRecord>& records) {
+	std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+	long long cells = graph->numberOfNodes();
+	std::vector<std::pair<int, int>> queries = createNodeQueries(*graph, 100);
+
+	records.push_back(measure_queries<AStar<BucketQueue>>("hierarchical/astar/query", graph, queries));
+
+	long long optimalLength = 0;
+	for (const auto& query : queries) {
+		graph->startNode() = query.first;
+		graph->endNode() = query.second;
+
+		BidirectionalDijkstra<BucketQueue> search(graph, graph->numberOfNodes());
+		while (search.step() != -1) {
+		}
+		if (search.pathWeight() > 0) {
+			optimalLength += static_cast<long long>(search.pathWeight());
+		}
+	}
+	records.push_back(makeRecord("hierarchical/optimal/path_length", cells, static_cast<int>(queries.size()), 0.0, optimalLength));
+
+	for (int clusterSize : clusterSizes) {
+		// every cluster size gets the same tiles, the update below blocks one
+		auto copy = std::make_shared<GridGraph>(*graph);
+		auto clusters = std::make_shared<ClusterAbstraction>(copy, clusterSize);
+		std::string name = "hierarchical/hpa_" + std::to_string(clusterSize);
+
+		records.push_back(makeRecord(name + "/build", cells, 1, clusters->buildMilliseconds(), cells));
+		records.push_back(makeRecord(name + "/entrances", cells, 1, 0.0, clusters->numberOfEntrances()));
+
+		auto begin = std::chrono::steady_clock::now();
+		long long hierarchicalLength = 0;
+		for (const auto& query : queries) {
+			copy->startNode() = query.first;
+			copy->endNode() = query.second;
+
+			HierarchicalAStar search(copy, clusters, copy->numberOfNodes());
+			while (search.step() != -1) {
+			}
+			if (search.pathWeight() > 0) {
+				hierarchicalLength += search.pathWeight();
+			}
+		}
+		auto end = std::chrono::steady_clock::now();
+		records.push_back(makeRecord(name + "/query", cells, static_cast<int>(queries.size()), elapsedMilliseconds(begin, end) / queries.size(), 1));
+		// against hierarchical/optimal/path_length
+		records.push_back(makeRecord(name + "/path_length", cells, static_cast<int>(queries.size()), 0.0, hierarchicalLength));
+
+		// one tile in the middle of a cluster border gets blocked, items are the clusters updated
+		copy->setBlocked(clusterSize - 1, clusterSize / 2, true);
+		clusters->invalidate(clusterSize - 1, clusterSize / 2);
+		int updated = clusters->update();
+		records.push_back(makeRecord(name + "/update", cells, 1, clusters->updateMilliseconds(), updated));
+	}
+}
+
+void benchmark_terrain(int side, int queryCount, std::vector<BenchmarkRecord>& records) {
+	std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+	std::vector<std::pair<int, int>> queries = createNodeQueries(*graph, queryCount);
+
+	// every tile costs 1: what following the weights costs by itself
+	records.push_back(measure_queries<Dijkstra<BucketQueue>>("terrain/dijkstra_bucket_queue/flat", graph, queries));
+	records.push_back(measure_queries<WeightedDijkstra<RadixHeap>>("terrain/weighted_dijkstra_radix_heap/flat", graph, queries));
+	records.push_back(measure_queries<AStar<BucketQueue>>("terrain/astar_bucket_queue/flat", graph, queries));
+	records.push_back(measure_queries<WeightedAStar<RadixHeap>>("terrain/weighted_astar_radix_heap/flat", graph, queries));
+
+	std::mt19937 random(7);
+	std::uniform_int_distribution<int> percent(0, 99);
+	std::uniform_int_distribution<int> cost(2, 8);
+	for (int y = 0; y < side; ++y) {
+		for (int x = 0; x < side; ++x) {
+			if (percent(random) < 30) {
+				graph->setCost(x, y, cost(random));
+			}
+		}
+	}
+
+	records.push_back(measure_queries<WeightedDijkstra<RadixHeap>>("terrain/weighted_dijkstra_radix_heap/costs", graph, queries));
+	records.push_back(measure_queries<WeightedDijkstra<DaryHeap<4>, float>>("terrain/weighted_dijkstra_dary_heap_4_float/costs", graph, queries));
+	records.push_back(measure_queries<WeightedAStar<RadixHeap>>("terrain/weighted_astar_radix_heap/costs", graph, queries));
+	records.push_back(measure_queries<WeightedAStar<DaryHeap<4>, float>>("terrain/weighted_astar_dary_heap_4_float/costs", graph, queries));
+}
+
+void benchmark_dstar_lite(int side, int replans, std::vector<BenchmarkRecord>& records) {
+	std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+	long long cells = graph->numberOfNodes();
+
+	auto begin = std::chrono::steady_clock::now();
+	DStarLite search(graph, graph->numberOfNodes());
+	while (search.step() != -1) {
+	}
+	auto end = std::chrono::steady_clock::now();
+	records.push_back(makeRecord("dstar_lite/dstar_lite/first_search", cells, 1, elapsedMilliseconds(begin, end), search.expansions()));
+
+	double replanMilliseconds = 0.0;
+	double searchMilliseconds = 0.0;
+	long long replanExpansions = 0;
+	long long searchExpansions = 0;
+	int replanned = 0;
+	for (int replan = 0; replan < replans && search.pathWeight() > 20; ++replan) {
+		// the path from the start to the end, the parents go the other way
+		std::vector<int> path;
+		for (int node = graph->endNode(); node != graph->startNode(); node = search.parents()[node]) {
+			path.push_back(node);
+		}
+		std::reverse(path.begin(), path.end());
+
+		// the agent walks 10 tiles and sees the tile 5 tiles ahead of it blocked
+		graph->startNode() = path[9];
+		search.moveStart(path[9]);
+		int x = 0;
+		int y = 0;
+		graph->coordinates(path[14], x, y);
+		graph->setBlocked(x, y, true);
+
+		int expansions = search.expansions();
+		begin = std::chrono::steady_clock::now();
+		search.tileChanged(x, y);
+		while (search.step() != -1) {
+		}
+		end = std::chrono::steady_clock::now();
+		replanMilliseconds += elapsedMilliseconds(begin, end);
+		replanExpansions += search.expansions() - expansions;
+
+		begin = std::chrono::steady_clock::now();
+		AStar<BucketQueue> astar(graph, graph->numberOfNodes());
+		while (astar.step() != -1) {
+			++searchExpansions;
+		}
+		end = std::chrono::steady_clock::now();
+		searchMilliseconds += elapsedMilliseconds(begin, end);
+		++replanned;
+	}
+
+	// runs are the replans, milliseconds and items the average of a replan
+	if (replanned > 0) {
+		records.push_back(makeRecord("dstar_lite/dstar_lite/replan", cells, replanned, replanMilliseconds / replanned, replanExpansions / replanned));
+		records.push_back(makeRecord("dstar_lite/astar_bucket_queue/replan", cells, replanned, searchMilliseconds / replanned, searchExpansions / replanned));
+	}
+}
+
+void benchmark_search_context(int side, int queryCount, std::vector<BenchmarkRecord>& records) {
+	std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+
+	// ends at most 16 tiles away in each direction
+	std::mt19937 random(5);
+	std::uniform_int_distribution<int> cell(0, graph->numberOfNodes() - 1);
+	std::uniform_int_distribution<int> offset(-16, 16);
+	std::vector<std::pair<int, int>> queries;
+	while (static_cast<int>(queries.size()) < queryCount) {
+		int startX = 0;
+		int startY = 0;
+		graph->coordinates(cell(random), startX, startY);
+		int endX = std::min(std::max(startX + offset(random), 0), side - 1);
+		int endY = std::min(std::max(startY + offset(random), 0), side - 1);
+		if (!graph->isBlocked(startX, startY) && !graph->isBlocked(endX, endY)) {
+			queries.push_back(std::make_pair(graph->index(startX, startY), graph->index(endX, endY)));
+		}
+	}
+
+	// the best of 3 passes over the queries
+	BenchmarkRecord fresh;
+	BenchmarkRecord reused;
+	SearchContext<BucketQueue> context(graph->numberOfNodes());
+	for (int run = 0; run < 3; ++run) {
+		BenchmarkRecord record = measure_queries<AStar<BucketQueue>>("short_queries/astar_bucket_queue/new_per_query", graph, queries);
+		if (run == 0 || record.milliseconds < fresh.milliseconds) {
+			fresh = record;
+		}
+
+		record = measure_queries("short_queries/astar_bucket_queue/search_context", graph, context, queries);
+		if (run == 0 || record.milliseconds < reused.milliseconds) {
+			reused = record;
+		}
+	}
+
+	records.push_back(fresh);
+	records.push_back(reused);
+}
+
+void benchmark_distance_field(int side, std::vector<BenchmarkRecord>& records) {
+	std::shared_ptr<GridGraph> graph = createRandomGrid(side, 20);
+	long long cells = graph->numberOfNodes();
+	// the end node is never reached, the search covers every reachable cell
+	graph->endNode() = -1;
+
+	int runs = runsFor(cells);
+	double breadthFirst = 0.0;
+	double bitboard = 0.0;
+	for (int run = 0; run < runs; ++run) {
+		auto begin = std::chrono::steady_clock::now();
+
+		BreadthFirstSearch search(graph, graph->numberOfNodes());
+		while (search.step() != -1) {
+		}
+
+		auto searched = std::chrono::steady_clock::now();
+
+		BitboardBreadthFirstSearch bitboardSearch(graph);
+		bitboardSearch.run();
+
+		auto end = std::chrono::steady_clock::now();
+		breadthFirst = keepBest(breadthFirst, elapsedMilliseconds(begin, searched), run);
+		bitboard = keepBest(bitboard, elapsedMilliseconds(searched, end), run);
+	}
+
+	records.push_back(makeRecord("distance_field/breadth_first/random", cells, runs, breadthFirst, cells));
+	records.push_back(makeRecord("distance_field/bitboard_breadth_first/random", cells, runs, bitboard, cells));
+}
+
+template<class Strategy>
+BenchmarkRecord measure_queries(const std::string& name, std::shared_ptr<GridGraph> graph, const std::vector<std::pair<int, int>>& queries) {
+	auto begin = std::chrono::steady_clock::now();
+
+	for (const auto& query : queries) {
+		graph->startNode() = query.first;
+		graph->endNode() = query.second;
+
+		Strategy strategy(graph, graph->numberOfNodes());
+		while (strategy.step() != -1) {
+		}
+	}
+
+	auto end = std::chrono::steady_clock::now();
+	return makeRecord(name, graph->numberOfNodes(), static_cast<int>(queries.size()), elapsedMilliseconds(begin, end) / queries.size(), 1);
+}
+
+BenchmarkRecord measure_queries(const std::string& name, std::shared_ptr<GridGraph> graph, std::shared_ptr<const ContractionHierarchy> hierarchy,
+	const std::vector<std::pair<int, int>>& queries) {
+	auto begin = std::chrono::steady_clock::now();
+
+	for (const auto& query : queries) {
+		graph->startNode() = query.first;
+		graph->endNode() = query.second;
+
+		ContractionHierarchyQuery strategy(graph, hierarchy, graph->numberOfNodes());
+		while (strategy.step() != -1) {
+		}
+	}
+
+	auto end = std::chrono::steady_clock::now();
+	return makeRecord(name, graph->numberOfNodes(), static_cast<int>(queries.size()), elapsedMilliseconds(begin, end) / queries.size(), 1);
+}
+
+BenchmarkRecord measure_queries(const std::string& name, std::shared_ptr<GridGraph> graph, SearchContext<BucketQueue>& context,
+	const std::vector<std::pair<int, int>>& queries) {
+	auto begin = std::chrono::steady_clock::now();
+
+	for (const auto& query : queries) {
+		graph->startNode() = query.first;
+		graph->endNode() = query.second;
+
+		AStar<BucketQueue> strategy(graph, context);
+		while (strategy.step() != -1) {
+		}
+	}
+
+	auto end = std::chrono::steady_clock::now();
+	return makeRecord(name, graph->numberOfNodes(), static_cast<int>(queries.size()), elapsedMilliseconds(begin, end) / queries.size(), 1);
+}
+
+bool fits(int side, long long maxCells) {
+	return static_cast<long long>(side) * side <= maxCells;
+}
+
+std::shared_ptr<GridGraph> createOpenGrid(int side) {
+	auto graph = std::make_shared<GridGraph>(side, side);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(side - 1, side - 1);
+
+	return graph;
+}
+
+std::shared_ptr<GridGraph> createRandomGrid(int side, int obstaclePercent) {
+	std::vector<bool> blocked = createObstacles(side, obstaclePercent);
+
+	auto graph = std::make_shared<GridGraph>(side, side);
+	for (int y = 0; y < side; ++y) {
+		for (int x = 0; x < side; ++x) {
+			graph->setBlocked(x, y, blocked[graph->index(x, y)]);
+		}
+	}
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(side - 1, side - 1);
+	graph->setBlocked(0, 0, false);
+	graph->setBlocked(side - 1, side - 1, false);
+
+	return graph;
+}
+
+std::shared_ptr<GridGraph> createMaze(int side) {
+	auto graph = std::make_shared<GridGraph>(side, side);
+	for (int y = 0; y < side; ++y) {
+		for (int x = 0; x < side; ++x) {
+			graph->setBlocked(x, y, true);
+		}
+	}
+
+	// the rooms are the cells with odd coordinates, the last one is at (last, last)
+	int last = (side - 2) % 2 == 1 ? side - 2 : side - 3;
+	const int moves[4][2] = { { 0, -2 }, { 0, 2 }, { -2, 0 }, { 2, 0 } };
+
+	std::mt19937 random(1);
+	std::vector<int> stack = { graph->index(1, 1) };
+	graph->setBlocked(1, 1, false);
+	while (!stack.empty()) {
+		int x = 0;
+		int y = 0;
+		graph->coordinates(stack.back(), x, y);
+
+		// rooms next to this one that the maze doesn't reach yet
+		int unvisited[4];
+		int count = 0;
+		for (int move = 0; move < 4; ++move) {
+			int nextX = x + moves[move][0];
+			int nextY = y + moves[move][1];
+			if (nextX >= 1 && nextX <= last && nextY >= 1 && nextY <= last && graph->isBlocked(nextX, nextY)) {
+				unvisited[count++] = move;
+			}
+		}
+		if (count == 0) {
+			stack.pop_back();
+			continue;
+		}
+
+		int move = unvisited[std::uniform_int_distribution<int>(0, count - 1)(random)];
+		int nextX = x + moves[move][0];
+		int nextY = y + moves[move][1];
+		// opens the wall between both rooms
+		graph->setBlocked(x + moves[move][0] / 2, y + moves[move][1] / 2, false);
+		graph->setBlocked(nextX, nextY, false);
+		stack.push_back(graph->index(nextX, nextY));
+	}
+
+	graph->startNode() = graph->index(1, 1);
+	graph->endNode() = graph->index(last, last);
+
+	return graph;
+}
+
+std::vector<bool> createObstacles(int side, int obstaclePercent) {
+	std::mt19937 random(1);
+	std::uniform_int_distribution<int> percent(0, 99);
+
+	std::vector<bool> blocked(static_cast<size_t>(side) * side);
+	for (size_t cell = 0; cell < blocked.size(); ++cell) {
+		blocked[cell] = percent(random) < obstaclePercent;
+	}
+
+	return blocked;
+}
+
+std::vector<GridQuery> createQueries(const GridGraph& graph, int count) {
+	std::mt19937 random(2);
+	std::uniform_int_distribution<int> cell(0, graph.numberOfNodes() - 1);
+	auto randomFreeCell = [&](int& x, int& y) {
+		do {
+			graph.coordinates(cell(random), x, y);
+		} while (graph.isBlocked(x, y));
+	};
+
+	std::vector<GridQuery> queries(count);
+	for (GridQuery& query : queries) {
+		randomFreeCell(query.startX, query.startY);
+		randomFreeCell(query.endX, query.endY);
+	}
+
+	return queries;
+}
+
+std::vector<std::pair<int, int>> createNodeQueries(const GridGraph& graph, int count) {
+	std::vector<std::pair<int, int>> queries;
+	for (const GridQuery& query : createQueries(graph, count)) {
+		queries.push_back(std::make_pair(graph.index(query.startX, query.startY), graph.index(query.endX, query.endY)));
+	}
+
+	return queries;
+}
+
+std::shared_ptr<GridGraph> createSerpentineGrid(int side) {
+	auto graph = std::make_shared<GridGraph>(side, side);
+	for (int y = 8, wall = 0; y < side - 1; y += 8, ++wall) {
+		int gap = wall % 2 == 0 ? side - 1 : 0;
+		for (int x = 0; x < side; ++x) {
+			graph->setBlocked(x, y, x != gap);
+		}
+	}
+
+	// start and end on the middle of the first and last corridors
+	graph->startNode() = graph->index(side / 2, 0);
+	graph->endNode() = graph->index(side / 2, side - 1);
+
+	return graph;
+}
+
+int runsFor(long long size) {
+	return size <= 1000000 ? 3 : 1;
+}
+
+double keepBest(double best, double milliseconds, int run) {
+	return run == 0 ? milliseconds : std::min(best, milliseconds);
+}
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end) {
+	return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+BenchmarkRecord makeRecord(const std::string& name, long long size, int runs, double milliseconds, long long items) {
+	BenchmarkRecord record;
+	record.name = name;
+	record.size = size;
+	record.runs = runs;
+	record.milliseconds = milliseconds;
+	record.items = items;
+
+	return record;
+}
+
+// the keys and their order never change within a schema version, one record per line
+void writeJson(std::ostream& output, long long maxCells, const std::vector<BenchmarkRecord>& records) {
+#ifdef NDEBUG
+	const char* build = "release";
+#else
+	const char* build = "debug";
+#endif
+
+	output << "{" << std::endl;
+	output << "  \"schema\": " << schemaVersion << "," << std::endl;
+	output << "  \"build\": \"" << build << "\"," << std::endl;
+	output << "  \"max_cells\": " << maxCells << "," << std::endl;
+	output << "  \"benchmarks\": [" << std::endl;
+	for (size_t i = 0; i < records.size(); ++i) {
+		const BenchmarkRecord& record = records[i];
+		double seconds = record.milliseconds / 1000.0;
+		double itemsPerSecond = seconds > 0.0 ? record.items / seconds : 0.0;
+		double nanosecondsPerItem = record.items > 0 ? record.milliseconds * 1000000.0 / record.items : 0.0;
+
+		output << "    {\"name\": \"" << record.name << "\", \"size\": " << record.size << ", \"runs\": " << record.runs <<
+			", \"milliseconds\": " << std::fixed << std::setprecision(4) << record.milliseconds << ", \"items\": " << record.items <<
+			", \"items_per_second\": " << std::setprecision(0) << itemsPerSecond << ", \"ns_per_item\": " << std::setprecision(3) <<
+			nanosecondsPerItem << std::defaultfloat << "}" << (i + 1 < records.size() ? "," : "") << std::endl;
+	}
+	output << "  ]" << std::endl;
+	output << "}" << std::endl;
+}
+
+void printUsage() {
+	std::cout << "Usage: ShortestPathBenchmarks [--max-cells n]" << std::endl;
+	std::cout << "  n: largest queue and grid measured, " << defaultMaxCells << " by default, 100000000 for every size" << std::endl;
+	std::cout << "  the results are written as JSON to the standard output" << std::endl;
+}
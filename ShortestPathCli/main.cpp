@@ -0,0 +1,290 @@
+#include "BatchQueryRunner.h"
+#include "GridMapLoader.h"
+#include "GridGraph.h"
+#include "QueryRunner.h"
+#include "ScenarioRunner.h"
+#include "SearchStatistics.h"
+#include "ShortestPathStrategyFactory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*************  FUNCTIONS  ***************/
+
+int runQueries(const char* mapPath, const char* queriesPath, ShortestPathAlgorithm algorithm);
+int runScenarios(const char* mapPath, const char* scenariosPath);
+int runBatch(const char* mapPath, const char* queriesPath, ShortestPathAlgorithm algorithm);
+std::shared_ptr<GridGraph> loadMap(const char* path);
+bool loadQueries(const char* path, const GridGraph& graph, std::vector<GridQuery>& queries);
+void printUsage();
+bool parseAlgorithm(const std::string& name, ShortestPathAlgorithm& algorithm);
+
+/***********  END FUNCTIONS  *************/
+
+// ShortestPathCli <map> <queries> [dijkstra|astar|bidijkstra|biastar|jps]
+// Runs every query of the file on the map and prints its cost, expansions and latency, then the totals.
+// ShortestPathCli --scen <map> <scen>
+// Runs every MovingAI scenario with Dijkstra and A*, checks the lengths and prints the latencies.
+// ShortestPathCli --batch <map> <queries> [dijkstra|astar]
+// Runs all the queries as one batch on 1, 2, 4... threads up to one per core and prints how it scales.
+int main(int argc, char** argv) {
+	if (argc == 4 && std::string(argv[1]) == "--scen") {
+		return runScenarios(argv[2], argv[3]);
+	}
+
+	if ((argc == 4 || argc == 5) && std::string(argv[1]) == "--batch") {
+		ShortestPathAlgorithm algorithm = ShortestPathAlgorithm::AStar;
+		if (argc == 5 && (!parseAlgorithm(argv[4], algorithm) ||
+			(algorithm != ShortestPathAlgorithm::Dijkstra && algorithm != ShortestPathAlgorithm::AStar))) {
+			std::cout << "Batches only run dijkstra or astar, not " << argv[4] << std::endl;
+			printUsage();
+			return 1;
+		}
+
+		return runBatch(argv[2], argv[3], algorithm);
+	}
+
+	if (argc < 3 || argc > 4) {
+		printUsage();
+		return 1;
+	}
+
+	ShortestPathAlgorithm algorithm = ShortestPathAlgorithm::AStar;
+	if (argc == 4 && !parseAlgorithm(argv[3], algorithm)) {
+		std::cout << "Unknown algorithm " << argv[3] << std::endl;
+		printUsage();
+		return 1;
+	}
+
+	return runQueries(argv[1], argv[2], algorithm);
+}
+
+int runQueries(const char* mapPath, const char* queriesPath, ShortestPathAlgorithm algorithm) {
+	std::shared_ptr<GridGraph> graph = loadMap(mapPath);
+	if (!graph) {
+		return 1;
+	}
+
+	std::vector<GridQuery> queries;
+	if (!loadQueries(queriesPath, *graph, queries)) {
+		return 1;
+	}
+
+	QueryRunner runner(graph, algorithm);
+	std::vector<GridQueryResult> results = runner.run(queries);
+
+	std::cout << std::left << std::setw(8) << "query" << std::setw(12) << "cost" << std::setw(12) << "expansions" << "ms" << std::endl;
+	size_t totalExpansions = 0;
+	double totalMilliseconds = 0.0;
+	size_t unreachable = 0;
+	SearchStatistics statistics;
+	for (size_t i = 0; i < results.size(); ++i) {
+		const GridQueryResult& result = results[i];
+		std::cout << std::setw(8) << i << std::setw(12);
+		if (result.cost < 0.0f) {
+			std::cout << "-";
+			++unreachable;
+		}
+		else {
+			std::cout << result.cost;
+		}
+		std::cout << std::setw(12) << result.expansions << std::fixed << std::setprecision(3) << result.milliseconds << std::defaultfloat << std::endl;
+
+		totalExpansions += result.expansions;
+		totalMilliseconds += result.milliseconds;
+		statistics += result.statistics;
+	}
+
+	std::cout << std::endl;
+	std::cout << "Queries: " << results.size() << " (" << unreachable << " without path)" << std::endl;
+	std::cout << "Expansions: " << totalExpansions << std::endl;
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Total ms: " << totalMilliseconds << std::endl;
+	std::cout << "Mean ms: " << (results.empty() ? 0.0 : totalMilliseconds / results.size()) << std::endl;
+	if (SearchStatistics::enabled()) {
+		std::cout << "Search statistics of all queries:" << std::endl;
+		printStatistics(std::cout, statistics, "  ");
+	}
+
+	return 0;
+}
+
+int runScenarios(const char* mapPath, const char* scenariosPath) {
+	std::shared_ptr<GridGraph> graph = loadMap(mapPath);
+	if (!graph) {
+		return 1;
+	}
+
+	std::ifstream scenariosFile(scenariosPath);
+	if (!scenariosFile) {
+		std::cout << "Error opening " << scenariosPath << std::endl;
+		return 1;
+	}
+	std::string error;
+	std::vector<Scenario> scenarios;
+	if (!GridMapLoader::loadScenarios(scenariosFile, *graph, scenarios, error)) {
+		std::cout << "Error loading " << scenariosPath << ", " << error << std::endl;
+		return 1;
+	}
+
+	const size_t shownMistakes = 10;
+	bool allOptimal = true;
+	for (ShortestPathAlgorithm algorithm : { ShortestPathAlgorithm::Dijkstra, ShortestPathAlgorithm::AStar }) {
+		ScenarioRunner runner(graph, algorithm);
+		std::vector<ScenarioResult> results = runner.run(scenarios);
+		ScenarioSummary summary = ScenarioRunner::summarize(scenarios, results);
+		allOptimal = allOptimal && summary.notOptimal == 0;
+
+		std::cout << (algorithm == ShortestPathAlgorithm::Dijkstra ? "Dijkstra" : "A*") << ": " << summary.scenarios << " scenarios, " <<
+			summary.notOptimal << " not optimal" << std::endl;
+		size_t shown = 0;
+		for (size_t i = 0; i < results.size() && shown < shownMistakes; ++i) {
+			if (!results[i].optimal) {
+				std::cout << "  scenario " << i << ": length " << std::setprecision(10) << results[i].length << ", optimal " <<
+					scenarios[i].optimalLength << std::endl;
+				++shown;
+			}
+		}
+
+		std::cout << std::fixed << std::setprecision(1) << "  Queries/s: " << summary.queriesPerSecond << std::setprecision(3) <<
+			", p50 ms: " << summary.p50Milliseconds << ", p99 ms: " << summary.p99Milliseconds << std::endl;
+		std::cout << "  " << std::left << std::setw(8) << "bucket" << std::setw(12) << "scenarios" << std::setw(12) << "expansions" << "ms" << std::endl;
+		for (const BucketSummary& bucket : summary.buckets) {
+			std::cout << "  " << std::setw(8) << bucket.bucket << std::setw(12) << bucket.scenarios << std::setw(12) << std::setprecision(1) <<
+				bucket.meanExpansions << std::setprecision(3) << bucket.meanMilliseconds << std::endl;
+		}
+		if (SearchStatistics::enabled()) {
+			std::cout << "  Search statistics of all scenarios:" << std::endl;
+			printStatistics(std::cout, summary.statistics, "    ");
+		}
+		std::cout << std::defaultfloat << std::right << std::endl;
+	}
+
+	return allOptimal ? 0 : 1;
+}
+
+int runBatch(const char* mapPath, const char* queriesPath, ShortestPathAlgorithm algorithm) {
+	std::shared_ptr<GridGraph> graph = loadMap(mapPath);
+	if (!graph) {
+		return 1;
+	}
+
+	std::vector<GridQuery> queries;
+	if (!loadQueries(queriesPath, *graph, queries)) {
+		return 1;
+	}
+
+	unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+	std::vector<unsigned int> threadCounts;
+	for (unsigned int threads = 1; threads < cores; threads *= 2) {
+		threadCounts.push_back(threads);
+	}
+	threadCounts.push_back(cores);
+
+	std::cout << "Queries: " << queries.size() << ", cores: " << cores << std::endl;
+	std::cout << std::left << std::setw(10) << "threads" << std::setw(12) << "ms" << std::setw(14) << "queries/s" << std::setw(10) <<
+		"speedup" << "stolen" << std::endl;
+
+	std::vector<GridQueryResult> expected;
+	double singleThreadMilliseconds = 0.0;
+	bool sameCosts = true;
+	for (unsigned int threads : threadCounts) {
+		BatchQueryRunner runner(graph, algorithm, threads);
+
+		auto begin = std::chrono::steady_clock::now();
+		std::vector<GridQueryResult> results = runner.run(queries);
+		double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+		if (threads == 1) {
+			expected = results;
+			singleThreadMilliseconds = milliseconds;
+		}
+		for (size_t i = 0; i < results.size(); ++i) {
+			if (results[i].cost != expected[i].cost) {
+				std::cout << "Query " << i << " costs " << results[i].cost << " with " << threads << " threads, " << expected[i].cost <<
+					" with 1" << std::endl;
+				sameCosts = false;
+			}
+		}
+
+		double seconds = milliseconds / 1000.0;
+		std::cout << std::setw(10) << threads << std::fixed << std::setprecision(3) << std::setw(12) << milliseconds << std::setprecision(1) <<
+			std::setw(14) << (seconds > 0.0 ? queries.size() / seconds : 0.0) << std::setprecision(2) << std::setw(10) <<
+			(milliseconds > 0.0 ? singleThreadMilliseconds / milliseconds : 0.0) << std::defaultfloat << runner.stolenQueries() << std::endl;
+	}
+
+	return sameCosts ? 0 : 1;
+}
+
+std::shared_ptr<GridGraph> loadMap(const char* path) {
+	std::ifstream mapFile(path);
+	if (!mapFile) {
+		std::cout << "Error opening " << path << std::endl;
+		return nullptr;
+	}
+
+	std::string error;
+	std::shared_ptr<GridGraph> graph = GridMapLoader::loadMap(mapFile, error);
+	if (!graph) {
+		std::cout << "Error loading " << path << ", " << error << std::endl;
+	}
+
+	return graph;
+}
+
+bool loadQueries(const char* path, const GridGraph& graph, std::vector<GridQuery>& queries) {
+	std::ifstream queriesFile(path);
+	if (!queriesFile) {
+		std::cout << "Error opening " << path << std::endl;
+		return false;
+	}
+
+	std::string error;
+	if (!GridMapLoader::loadQueries(queriesFile, graph, queries, error)) {
+		std::cout << "Error loading " << path << ", " << error << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+void printUsage() {
+	std::cout << "Usage: ShortestPathCli <map> <queries> [dijkstra|astar|bidijkstra|biastar|jps]" << std::endl;
+	std::cout << "       ShortestPathCli --scen <map> <scen>" << std::endl;
+	std::cout << "       ShortestPathCli --batch <map> <queries> [dijkstra|astar]" << std::endl;
+	std::cout << "  map: one line per row, '.' free, '#' blocked, '2' to '9' terrain cost, or a MovingAI .map" << std::endl;
+	std::cout << "  queries: one per line, \"startX startY endX endY\"" << std::endl;
+	std::cout << "  scen: a MovingAI .scen made for the map, run with Dijkstra and A* on 8-connected moves" << std::endl;
+	std::cout << "  --batch: runs the queries on 1, 2, 4... threads up to one per core and checks they all find the same costs" << std::endl;
+}
+
+bool parseAlgorithm(const std::string& name, ShortestPathAlgorithm& algorithm) {
+	if (name == "dijkstra") {
+		algorithm = ShortestPathAlgorithm::Dijkstra;
+	}
+	else if (name == "astar") {
+		algorithm = ShortestPathAlgorithm::AStar;
+	}
+	else if (name == "bidijkstra") {
+		algorithm = ShortestPathAlgorithm::BidirectionalDijkstra;
+	}
+	else if (name == "biastar") {
+		algorithm = ShortestPathAlgorithm::BidirectionalAStar;
+	}
+	else if (name == "jps") {
+		algorithm = ShortestPathAlgorithm::JumpPointSearch;
+	}
+	else {
+		return false;
+	}
+
+	return true;
+}
@@ -1,34 +1,41 @@
 #pragma once
 
-#include "IShortestPathStrategy.h"
-
-#include "Graph.h"
-#include "MinHeap.h"
-
-#include <memory>
-#include <vector>
-
-class AStar :
-    public IShortestPathStrategy
-{
-public:
-	AStar(std::shared_ptr<Graph> graph, size_t capacity) :
-		IShortestPathStrategy(capacity),
-		_graph(graph),
-		_minHeap(capacity),
-		_weightsFromStart(capacity, -1.0f) {
-		initialize();
-	}
-
-	virtual ~AStar() = default;
-
-	int step() override final;
-private:
-	void initialize();
-	void relaxEdge(int u, int v);
-	float heuristicDistance(const Graph::Node& a, const Graph::Node& b)const;
-	std::shared_ptr<Graph> _graph;
-	MinHeap _minHeap;
-	std::vector<float> _weightsFromStart;
-};
+#include "BestFirstSearch.h"
+#include "BucketQueue.h"
+#include "DaryHeap.h"
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "RadixHeap.h"
+#include "SearchPolicies.h"
 
+#include <stdint.h>
+
+// A* over any IGraph with the Manhattan distance, every edge costs 1.
+// Pass ManhattanHeuristic(landmarks) to raise it to the landmark bounds (ALT).
+// PriorityQueue can be DaryHeap<2/4/8>, MinHeapQueue, BucketQueue or RadixHeap.
+// The keys stay integer, so the integer queues can be used for unit edge weights.
+template<class PriorityQueue = DaryHeap<4>>
+using AStar = BestFirstSearch<IGraph, float, PriorityQueue, ManhattanHeuristic, UnitEdges>;
+
+// the same search on a GridGraph known at compile time, even step() calls the grid directly
+template<class PriorityQueue = DaryHeap<4>>
+using GridAStar = BestFirstSearch<GridGraph, float, PriorityQueue, ManhattanHeuristic, UnitEdges>;
+
+// both with integer distances, uint32_t or uint16_t (paths shorter than 65535 steps), see IntegerDijkstra
+template<class PriorityQueue = BucketQueue, class Cost = uint32_t>
+using IntegerAStar = BestFirstSearch<IGraph, Cost, PriorityQueue, ManhattanHeuristic, UnitEdges>;
+
+template<class PriorityQueue = BucketQueue, class Cost = uint32_t>
+using IntegerGridAStar = BestFirstSearch<GridGraph, Cost, PriorityQueue, ManhattanHeuristic, UnitEdges>;
+
+// A* over the edge weights of the graph (terrain costs of a GridGraph), the Manhattan distance
+// is scaled by the minimum edge weight. RadixHeap by default, like WeightedDijkstra
+template<class PriorityQueue = RadixHeap, class Cost = uint32_t>
+using WeightedAStar = BestFirstSearch<IGraph, Cost, PriorityQueue, ManhattanHeuristic, WeightedEdges>;
+
+template<class PriorityQueue = RadixHeap, class Cost = uint32_t>
+using WeightedGridAStar = BestFirstSearch<GridGraph, Cost, PriorityQueue, ManhattanHeuristic, WeightedEdges>;
+
+// A* on an 8-connected GridGraph with the octile distance, see OctileDijkstra
+template<class PriorityQueue = DaryHeap<4>, CornerCutting Cutting = CornerCutting::Never>
+using OctileAStar = BestFirstSearch<GridGraph, float, PriorityQueue, OctileHeuristic, EightConnectedEdges<Cutting>>;
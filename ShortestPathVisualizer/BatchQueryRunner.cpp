@@ -0,0 +1,207 @@
+#include "BatchQueryRunner.h"
+
+#include "AStar.h"
+#include "BucketQueue.h"
+#include "Dijkstra.h"
+#include "GridGraph.h"
+#include "QueryRunner.h"
+#include "RadixHeap.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class IQuerySolver
+{
+public:
+	virtual ~IQuerySolver() = default;
+
+	virtual GridQueryResult solve(const GridQuery& query) = 0;
+};
+
+namespace {
+	// Search on a context that lives as long as the worker
+	template<class Search>
+	class QuerySolver :
+		public IQuerySolver
+	{
+	public:
+		QuerySolver(std::shared_ptr<const GridGraph> graph) :
+			_graph(graph),
+			_context(graph->numberOfNodes()) {
+		}
+
+		GridQueryResult solve(const GridQuery& query) override {
+			int start = _graph->index(query.startX, query.startY);
+			int end = _graph->index(query.endX, query.endY);
+
+			GridQueryResult result;
+			result.expansions = 0;
+
+			auto begin = std::chrono::steady_clock::now();
+			Search search(_graph, _context, start, end);
+			while (search.step() != -1) {
+				++result.expansions;
+			}
+			result.cost = _context.isReached(end) ? static_cast<float>(_context.distance(end)) : -1.0f;
+			auto finish = std::chrono::steady_clock::now();
+
+			result.milliseconds = std::chrono::duration<double, std::milli>(finish - begin).count();
+			result.statistics = search.statistics();
+			return result;
+		}
+	private:
+		std::shared_ptr<const GridGraph> _graph;
+		typename Search::Context _context;
+	};
+
+	// the searches of ShortestPathStrategyFactory on integer costs, compiled for the grid
+	std::unique_ptr<IQuerySolver> createSolver(std::shared_ptr<const GridGraph> graph, ShortestPathAlgorithm algorithm) {
+		bool uniformWeights = graph->hasUniformEdgeWeights();
+		if (algorithm == ShortestPathAlgorithm::Dijkstra) {
+			if (uniformWeights) {
+				return std::unique_ptr<IQuerySolver>(new QuerySolver<IntegerGridDijkstra<BucketQueue>>(graph));
+			}
+			return std::unique_ptr<IQuerySolver>(new QuerySolver<WeightedGridDijkstra<RadixHeap>>(graph));
+		}
+
+		if (uniformWeights) {
+			return std::unique_ptr<IQuerySolver>(new QuerySolver<IntegerGridAStar<BucketQueue>>(graph));
+		}
+		return std::unique_ptr<IQuerySolver>(new QuerySolver<WeightedGridAStar<RadixHeap>>(graph));
+	}
+}
+
+BatchQueryRunner::BatchQueryRunner(std::shared_ptr<const GridGraph> graph, ShortestPathAlgorithm algorithm, unsigned int threads) :
+	_graph(graph),
+	_batch(0),
+	_running(0),
+	_stopping(false),
+	_queries(nullptr),
+	_results(nullptr),
+	_stolen(0) {
+	assert(algorithm == ShortestPathAlgorithm::Dijkstra || algorithm == ShortestPathAlgorithm::AStar);
+
+	if (threads == 0) {
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	// every solver is created before any thread starts looking at the others
+	for (unsigned int i = 0; i < threads; ++i) {
+		std::unique_ptr<Worker> worker(new Worker());
+		worker->begin = 0;
+		worker->end = 0;
+		worker->solver = createSolver(graph, algorithm);
+		_workers.push_back(std::move(worker));
+	}
+	for (size_t i = 0; i < _workers.size(); ++i) {
+		_workers[i]->thread = std::thread(&BatchQueryRunner::work, this, i);
+	}
+}
+
+BatchQueryRunner::~BatchQueryRunner() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_batchReady.notify_all();
+
+	for (auto& worker : _workers) {
+		worker->thread.join();
+	}
+}
+
+std::vector<GridQueryResult> BatchQueryRunner::run(const std::vector<GridQuery>& queries) {
+	std::vector<GridQueryResult> results(queries.size());
+
+	size_t workers = _workers.size();
+	for (size_t i = 0; i < workers; ++i) {
+		Worker& worker = *_workers[i];
+		std::lock_guard<std::mutex> lock(worker.mutex);
+		worker.begin = queries.size() * i / workers;
+		worker.end = queries.size() * (i + 1) / workers;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_queries = &queries;
+	_results = &results;
+	_running = workers;
+	_stolen = 0;
+	++_batch;
+	_batchReady.notify_all();
+
+	_batchDone.wait(lock, [this]() { return _running == 0; });
+	_queries = nullptr;
+	_results = nullptr;
+
+	return results;
+}
+
+void BatchQueryRunner::work(size_t worker) {
+	IQuerySolver& solver = *_workers[worker]->solver;
+	uint64_t batch = 0;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_batchReady.wait(lock, [this, batch]() { return _stopping || _batch != batch; });
+			if (_stopping) {
+				return;
+			}
+			batch = _batch;
+		}
+
+		// every query has its own slot in the results, no lock needed to write it
+		size_t query = 0;
+		while (nextQuery(worker, query)) {
+			(*_results)[query] = solver.solve((*_queries)[query]);
+		}
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		--_running;
+		if (_running == 0) {
+			_batchDone.notify_one();
+		}
+	}
+}
+
+bool BatchQueryRunner::nextQuery(size_t worker, size_t& query) {
+	Worker& self = *_workers[worker];
+	{
+		std::lock_guard<std::mutex> lock(self.mutex);
+		if (self.begin < self.end) {
+			query = self.begin++;
+			return true;
+		}
+	}
+
+	// never holds two worker locks at once: the stolen queries are taken out of the victim's share
+	// first, then become the own share (where others can steal them back)
+	for (size_t offset = 1; offset < _workers.size(); ++offset) {
+		Worker& victim = *_workers[(worker + offset) % _workers.size()];
+		size_t begin = 0;
+		size_t end = 0;
+		{
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			size_t left = victim.end - victim.begin;
+			if (left == 0) {
+				continue;
+			}
+			end = victim.end;
+			begin = end - (left + 1) / 2;
+			victim.end = begin;
+		}
+
+		_stolen += end - begin;
+		query = begin;
+		std::lock_guard<std::mutex> lock(self.mutex);
+		self.begin = begin + 1;
+		self.end = end;
+		return true;
+	}
+
+	return false;
+}
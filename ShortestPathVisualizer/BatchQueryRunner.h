@@ -0,0 +1,69 @@
+#pragma once
+
+#include "GridGraph.h"
+#include "QueryRunner.h"
+#include "ShortestPathStrategyFactory.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+// runs queries of a batch with the search context of one worker (defined in BatchQueryRunner.cpp)
+class IQuerySolver;
+
+// Runs batches of queries on one grid with a pool of threads. Unlike QueryRunner the grid is only read:
+// every search gets the start and end of its query, so the grid must not change while the runner lives.
+// Every worker keeps one SearchContext for all the queries it runs, nothing is allocated per query.
+// A batch is split in equal shares of consecutive queries, a worker that runs out of queries steals
+// the back half of the share another one has left. The results come back in the order of the queries.
+// Dijkstra and A* only (4-connected, with the terrain costs of the grid when it has any).
+class BatchQueryRunner
+{
+public:
+	// threads 0 starts one worker per core (std::thread::hardware_concurrency())
+	BatchQueryRunner(std::shared_ptr<const GridGraph> graph, ShortestPathAlgorithm algorithm, unsigned int threads = 0);
+	~BatchQueryRunner();
+
+	BatchQueryRunner(const BatchQueryRunner&) = delete;
+	BatchQueryRunner& operator=(const BatchQueryRunner&) = delete;
+
+	// blocks until every query ran, one batch at a time
+	std::vector<GridQueryResult> run(const std::vector<GridQuery>& queries);
+
+	unsigned int threads()const { return static_cast<unsigned int>(_workers.size()); }
+	// queries of the last batch run by another worker than the one they were given to
+	size_t stolenQueries()const { return _stolen; }
+
+private:
+	struct Worker {
+		// [begin, end) are the queries of its share not taken yet, by itself or by thieves
+		std::mutex mutex;
+		size_t begin;
+		size_t end;
+		std::unique_ptr<IQuerySolver> solver;
+		std::thread thread;
+	};
+
+	void work(size_t worker);
+	// next query of worker, from its own share or stolen; false when no share has any left
+	bool nextQuery(size_t worker, size_t& query);
+
+	std::shared_ptr<const GridGraph> _graph;
+	std::vector<std::unique_ptr<Worker>> _workers;
+
+	// the batch being run, the workers wait for _batch to change
+	std::mutex _mutex;
+	std::condition_variable _batchReady;
+	std::condition_variable _batchDone;
+	uint64_t _batch;
+	size_t _running;
+	bool _stopping;
+	const std::vector<GridQuery>* _queries;
+	std::vector<GridQueryResult>* _results;
+	std::atomic<size_t> _stolen;
+};
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "IShortestPathStrategy.h"
+
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "SearchContext.h"
+#include "SearchStatistics.h"
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Best first search engine behind Dijkstra and AStar, put together at compile time from:
+//	- Graph: IGraph, or a concrete graph (GridGraph, Graph) whose final functions are then called directly
+//	- Cost: float, uint16_t or uint32_t (distances stored in the SearchContext)
+//	- PriorityQueue: DaryHeap<2/4/8>, MinHeapQueue, BucketQueue or RadixHeap (the last two need integer keys),
+//	  with integer costs the keys are given to the queue in its own KeyType (DaryHeap<4, uint32_t> for an integer heap)
+//	- Heuristic: ZeroHeuristic (Dijkstra), ManhattanHeuristic (A*, optionally with landmarks),
+//	  OctileHeuristic (A* with diagonal moves), see SearchPolicies.h
+//	- Expansion: the edges leaving a node and their costs, UnitEdges for neighbors() with cost 1,
+//	  WeightedEdges for the edge weights of the graph (terrain costs), EightConnectedEdges for the
+//	  8 neighbors of a GridGraph cell
+// Every combination is compiled on its own, the loop of solve() has no virtual call.
+// The heuristic must be consistent: a node's distance is final when it is popped and it is closed.
+// Distances, parents and the queue live in a SearchContext, owned by the search or borrowed from the caller.
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+class BestFirstSearch :
+	public IShortestPathStrategy
+{
+public:
+	typedef SearchContext<PriorityQueue, Cost> Context;
+
+	BestFirstSearch(std::shared_ptr<const Graph> graph, size_t capacity, Heuristic heuristic = Heuristic(), Expansion expansion = Expansion()) :
+		IShortestPathStrategy(capacity),
+		_graph(graph),
+		_heuristic(heuristic),
+		_expansion(expansion),
+		_ownedContext(new Context(capacity)),
+		_context(*_ownedContext),
+		_start(graph->startNode()),
+		_end(graph->endNode()) {
+		initialize();
+	}
+
+	// runs on context (reset here), which must outlive the search; nothing is allocated or cleared per node.
+	// parents() stays empty, the path is read from context.parent()
+	BestFirstSearch(std::shared_ptr<const Graph> graph, Context& context, Heuristic heuristic = Heuristic(), Expansion expansion = Expansion()) :
+		IShortestPathStrategy(0),
+		_graph(graph),
+		_heuristic(heuristic),
+		_expansion(expansion),
+		_context(context),
+		_start(graph->startNode()),
+		_end(graph->endNode()) {
+		_context.reset();
+		initialize();
+	}
+
+	// from start to end instead of the start and end nodes of graph, which is only read:
+	// threads can search the same graph at once, each on a context of its own
+	BestFirstSearch(std::shared_ptr<const Graph> graph, Context& context, int start, int end, Heuristic heuristic = Heuristic(), Expansion expansion = Expansion()) :
+		IShortestPathStrategy(0),
+		_graph(graph),
+		_heuristic(heuristic),
+		_expansion(expansion),
+		_context(context),
+		_start(start),
+		_end(end) {
+		_context.reset();
+		initialize();
+	}
+
+	virtual ~BestFirstSearch() = default;
+
+	int step() override final {
+		return expand(*_graph);
+	}
+
+	SearchResult solve() override final;
+	SearchStatistics statistics()const override final { return _counters.statistics(); }
+private:
+	// float costs keep float keys (the integer queues check they hold integer values),
+	// integer costs go to the queue without passing through float
+	typedef typename std::conditional<std::is_floating_point<Cost>::value, float, typename PriorityQueue::KeyType>::type Key;
+
+	void initialize();
+	// pops the next node and relaxes its edges, returns it (-1 when the search is over)
+	template<class G>
+	int expand(const G& graph);
+	template<class G>
+	void relaxEdge(const G& graph, int u, int v, Cost edgeCost);
+	// float distances of equal paths added up in another order differ in their last bits, that is no shorter path
+	static bool isShorter(Cost distance, Cost than, std::true_type) { return distance < than - than * 1e-5f; }
+	static bool isShorter(Cost distance, Cost than, std::false_type) { return distance < than; }
+	// the queue operations, counted and timed with SHORTEST_PATH_STATISTICS
+	void queueInsert(int node, Key key);
+	int queuePop();
+	void queueDecreaseKey(int node, Key key);
+
+	// a GridGraph behind an IGraph is searched as a GridGraph
+	void run(const IGraph& graph);
+	template<class G>
+	void run(const G& graph);
+
+	std::shared_ptr<const Graph> _graph;
+	Heuristic _heuristic;
+	Expansion _expansion;
+	std::unique_ptr<Context> _ownedContext;
+	Context& _context;
+	int _start;
+	int _end;
+	SearchCounters _counters;
+};
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+SearchResult BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::solve() {
+	run(*_graph);
+
+	float distance = _context.isReached(_end) ? static_cast<float>(_context.distance(_end)) : -1.0f;
+	return makeResult(_start, _end, distance, [this](int node) { return _context.parent(node); });
+}
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+void BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::initialize() {
+	_heuristic.target(*_graph, _end);
+
+	// the start is reached with distance 0 and goes into the queue,
+	// its key is just the heuristic (monotone queues need every key to be the real f value)
+	_context.reach(_start, Cost(0), -1);
+	queueInsert(_start, static_cast<Key>(_heuristic.template estimate<Cost>(*_graph, _start)));
+}
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+template<class G>
+int BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::expand(const G& graph) {
+	PriorityQueue& queue = _context.queue();
+	if (queue.isEmpty()) {
+		//no more nodes
+		return -1;
+	}
+
+	SearchCounters::ExpansionTimer timer(_counters);
+	int minNode = queuePop();
+
+	if (minNode == _end) {
+		// I found the end node, therefore finish (emptying the queue, so later calls don't search on)
+		queue.clear();
+		return -1;
+	}
+
+	// its distance is final, edges back to it are skipped
+	_context.close(minNode);
+	_counters.expanded();
+	_expansion.template expand<Cost>(graph, minNode, [&](int adjNode, Cost edgeCost) {
+		relaxEdge(graph, minNode, adjNode, edgeCost);
+	});
+
+	return minNode;
+}
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+template<class G>
+void BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::relaxEdge(const G& graph, int u, int v, Cost edgeCost) {
+	_counters.generated();
+	if (_context.isClosed(v)) {
+		_counters.reachedExpanded(isShorter(_context.distance(u) + edgeCost, _context.distance(v), std::is_floating_point<Cost>()));
+		return;
+	}
+
+	Cost newWeight = _context.distance(u) + edgeCost;
+	if (!_context.isReached(v)) {
+		// v hasn't been visited yet by this search
+
+		// store its weight and parent ...
+		_context.reach(v, newWeight, u);
+
+		// and insert v into the queue
+		queueInsert(v, static_cast<Key>(newWeight + _heuristic.template estimate<Cost>(graph, v)));
+	}
+	else if (_context.distance(v) > newWeight) {
+		_context.reach(v, newWeight, u);
+		queueDecreaseKey(v, static_cast<Key>(newWeight + _heuristic.template estimate<Cost>(graph, v)));
+	}
+	else {
+		return;
+	}
+
+	if (!_parents.empty()) {
+		// a search with its own context also fills parents()
+		_parents[v] = u;
+	}
+}
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+void BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::queueInsert(int node, Key key) {
+	{
+		SearchCounters::QueueTimer timer(_counters);
+		_context.queue().insert(node, key);
+	}
+	_counters.inserted(_context.queue().size());
+}
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+int BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::queuePop() {
+	SearchCounters::QueueTimer timer(_counters);
+	_counters.popped();
+	int node = _context.queue().top();
+	_context.queue().pop();
+	return node;
+}
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+void BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::queueDecreaseKey(int node, Key key) {
+	SearchCounters::QueueTimer timer(_counters);
+	_counters.decreasedKey();
+	_context.queue().decreaseKey(node, key);
+}
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+void BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::run(const IGraph& graph) {
+	const GridGraph* grid = dynamic_cast<const GridGraph*>(&graph);
+	if (grid != nullptr) {
+		run<GridGraph>(*grid);
+		return;
+	}
+
+	while (expand(graph) != -1) {
+	}
+}
+
+template<class Graph, class Cost, class PriorityQueue, class Heuristic, class Expansion>
+template<class G>
+void BestFirstSearch<Graph, Cost, PriorityQueue, Heuristic, Expansion>::run(const G& graph) {
+	while (expand(graph) != -1) {
+	}
+}
@@ -0,0 +1,189 @@
+#include "BidirectionalSearch.h"
+
+#include "BucketQueue.h"
+#include "DaryHeap.h"
+#include "IGraph.h"
+#include "MinHeapQueue.h"
+#include "RadixHeap.h"
+#include "SearchStatistics.h"
+
+#include <assert.h>
+#include <memory>
+#include <stdlib.h>
+#include <vector>
+
+template<class PriorityQueue>
+BidirectionalSearch<PriorityQueue>::BidirectionalSearch(std::shared_ptr<const IGraph> graph, size_t capacity, bool useHeuristic) :
+	IShortestPathStrategy(capacity),
+	_graph(graph),
+	_useHeuristic(useHeuristic),
+	_forward(capacity),
+	_reverse(capacity),
+	_reverseParents(capacity, -1),
+	_forwardTurn(true),
+	_finished(false),
+	_bestWeight(-1.0f),
+	_meetingNode(-1) {
+	assert(_graph->hasUniformEdgeWeights());
+	int start = _graph->startNode();
+	int end = _graph->endNode();
+
+	// every side heads towards the origin of the other one
+	_graph->coordinates(end, _forward.targetX, _forward.targetY);
+	_graph->coordinates(start, _reverse.targetX, _reverse.targetY);
+
+	_forward.weights[start] = 0.0f;
+	_forward.queue.insert(start, heuristicDistance(_forward, start));
+	_counters.inserted(_forward.queue.size());
+
+	_reverse.weights[end] = 0.0f;
+	_reverse.queue.insert(end, heuristicDistance(_reverse, end));
+	_counters.inserted(_reverse.queue.size());
+
+	if (start == end) {
+		_bestWeight = 0.0f;
+		_meetingNode = start;
+	}
+}
+
+template<class PriorityQueue>
+int BidirectionalSearch<PriorityQueue>::step() {
+	if (_finished) {
+		return -1;
+	}
+
+	if (isFinished()) {
+		finish();
+		return -1;
+	}
+
+	// alternate sides
+	bool forward = _forwardTurn;
+	_forwardTurn = !_forwardTurn;
+
+	Side& side = forward ? _forward : _reverse;
+	Side& otherSide = forward ? _reverse : _forward;
+	std::vector<int>& parents = forward ? _parents : _reverseParents;
+
+	SearchCounters::ExpansionTimer timer(_counters);
+	int minNode = -1;
+	{
+		SearchCounters::QueueTimer queueTimer(_counters);
+		minNode = side.queue.top();
+		side.queue.pop();
+	}
+	_counters.popped();
+
+	_counters.expanded();
+	for (int adjNode : _graph->neighbors(minNode, _neighborBuffer)) {
+		_counters.generated();
+		relaxEdge(side, otherSide, parents, minNode, adjNode);
+	}
+
+	return minNode;
+}
+
+template<class PriorityQueue>
+SearchResult BidirectionalSearch<PriorityQueue>::solve() {
+	while (step() != -1) {
+	}
+
+	return makeResult(_graph->startNode(), _graph->endNode(), _bestWeight);
+}
+
+template<class PriorityQueue>
+bool BidirectionalSearch<PriorityQueue>::isFinished()const {
+	if (_forward.queue.isEmpty() || _reverse.queue.isEmpty()) {
+		// one side explored everything it can reach, nothing else can be found
+		return true;
+	}
+
+	if (_bestWeight < 0.0f) {
+		return false;
+	}
+
+	if (_useHeuristic) {
+		// with consistent heuristics the top key of a side is a lower bound of every path not found yet
+		return _forward.queue.topKey() >= _bestWeight || _reverse.queue.topKey() >= _bestWeight;
+	}
+
+	// any shorter path would need a node whose distances from both sides are at least the tops
+	return _forward.queue.topKey() + _reverse.queue.topKey() >= _bestWeight;
+}
+
+template<class PriorityQueue>
+void BidirectionalSearch<PriorityQueue>::finish() {
+	_finished = true;
+
+	if (_meetingNode < 0) {
+		// no path
+		return;
+	}
+
+	// the forward tree already leads from the meeting node to the start,
+	// reverse the second half so it leads from the end to the meeting node
+	int end = _graph->endNode();
+	int current = _meetingNode;
+	while (current != end) {
+		int next = _reverseParents[current];
+		_parents[next] = current;
+		current = next;
+	}
+}
+
+template<class PriorityQueue>
+void BidirectionalSearch<PriorityQueue>::relaxEdge(Side& side, Side& otherSide, std::vector<int>& parents, int u, int v) {
+	float newVWeight = side.weights[u] + 1.0f; // every edge has weight equal to 1
+	float vWeight = side.weights[v];
+
+	if (vWeight < 0.0f) {
+		side.weights[v] = newVWeight;
+		float key = newVWeight + heuristicDistance(side, v);
+		{
+			SearchCounters::QueueTimer timer(_counters);
+			side.queue.insert(v, key);
+		}
+		_counters.inserted(side.queue.size());
+		parents[v] = u;
+	}
+	else if (vWeight > newVWeight) {
+		side.weights[v] = newVWeight;
+		float key = newVWeight + heuristicDistance(side, v);
+		{
+			SearchCounters::QueueTimer timer(_counters);
+			side.queue.decreaseKey(v, key);
+		}
+		_counters.decreasedKey();
+		parents[v] = u;
+	}
+	else {
+		return;
+	}
+
+	// v was reached by the other side too, so there is a path through it
+	float otherWeight = otherSide.weights[v];
+	if (otherWeight >= 0.0f && (_bestWeight < 0.0f || newVWeight + otherWeight < _bestWeight)) {
+		_bestWeight = newVWeight + otherWeight;
+		_meetingNode = v;
+	}
+}
+
+template<class PriorityQueue>
+float BidirectionalSearch<PriorityQueue>::heuristicDistance(const Side& side, int node)const {
+	if (!_useHeuristic) {
+		return 0.0f;
+	}
+
+	int x = 0;
+	int y = 0;
+	_graph->coordinates(node, x, y);
+
+	return static_cast<float>(abs(side.targetX - x) + abs(side.targetY - y));
+}
+
+template class BidirectionalSearch<DaryHeap<2>>;
+template class BidirectionalSearch<DaryHeap<4>>;
+template class BidirectionalSearch<DaryHeap<8>>;
+template class BidirectionalSearch<MinHeapQueue>;
+template class BidirectionalSearch<BucketQueue>;
+template class BidirectionalSearch<RadixHeap>;
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "IShortestPathStrategy.h"
+
+#include "DaryHeap.h"
+#include "IGraph.h"
+#include "SearchStatistics.h"
+
+#include <memory>
+#include <vector>
+
+// Searches from the start node and from the end node at the same time, step() alternates
+// between both sides so both wavefronts can be animated. The graph must be undirected
+// (the reverse search walks the same neighbors), which is the case for the grids.
+// Every edge weighs 1, grids with terrain costs are asserted against.
+// When the search ends parents() holds the whole start -> end path (forward tree up to the
+// meeting node, then the reverse tree rewritten to point back to the start).
+// PriorityQueue can be DaryHeap<2/4/8>, MinHeapQueue, BucketQueue or RadixHeap (instantiated in BidirectionalSearch.cpp).
+template<class PriorityQueue = DaryHeap<4>>
+class BidirectionalSearch :
+    public IShortestPathStrategy
+{
+public:
+	virtual ~BidirectionalSearch() = default;
+
+	int step() override final;
+	SearchResult solve() override final;
+	// both sides together, reopenings stay 0
+	SearchStatistics statistics()const override final { return _counters.statistics(); }
+
+	// length of the shortest path found so far (negative while no path is known)
+	float pathWeight()const { return _bestWeight; }
+	int meetingNode()const { return _meetingNode; }
+protected:
+	// without heuristic the search stops when the sum of both queue tops reaches the best path (Dijkstra),
+	// with heuristic every side is an A* towards the other end and the search stops when either top reaches it
+	BidirectionalSearch(std::shared_ptr<const IGraph> graph, size_t capacity, bool useHeuristic);
+private:
+	struct Side {
+		Side(size_t capacity) :
+			queue(capacity),
+			weights(capacity, -1.0f),
+			targetX(0),
+			targetY(0) {
+		}
+
+		PriorityQueue queue;
+		std::vector<float> weights;	// weights from the side origin (less than zero like infinite)
+		int targetX;				// the other end, used by the heuristic
+		int targetY;
+	};
+
+	bool isFinished()const;
+	void finish();
+	void relaxEdge(Side& side, Side& otherSide, std::vector<int>& parents, int u, int v);
+	float heuristicDistance(const Side& side, int node)const;
+
+	std::shared_ptr<const IGraph> _graph;
+	bool _useHeuristic;
+	Side _forward;
+	Side _reverse;
+	std::vector<int> _reverseParents;
+	bool _forwardTurn;
+	bool _finished;
+	float _bestWeight;
+	int _meetingNode;
+	IGraph::NeighborBuffer _neighborBuffer;
+	SearchCounters _counters;
+};
+
+template<class PriorityQueue = DaryHeap<4>>
+class BidirectionalDijkstra :
+	public BidirectionalSearch<PriorityQueue>
+{
+public:
+	BidirectionalDijkstra(std::shared_ptr<const IGraph> graph, size_t capacity) :
+		BidirectionalSearch<PriorityQueue>(graph, capacity, false) {
+	}
+
+	virtual ~BidirectionalDijkstra() = default;
+};
+
+template<class PriorityQueue = DaryHeap<4>>
+class BidirectionalAStar :
+	public BidirectionalSearch<PriorityQueue>
+{
+public:
+	BidirectionalAStar(std::shared_ptr<const IGraph> graph, size_t capacity) :
+		BidirectionalSearch<PriorityQueue>(graph, capacity, true) {
+	}
+
+	virtual ~BidirectionalAStar() = default;
+};
@@ -0,0 +1,270 @@
+#include "BitboardBreadthFirstSearch.h"
+
+#include "GridGraph.h"
+#include "IGraph.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+constexpr uint32_t BitboardBreadthFirstSearch::unreachable;
+
+BitboardBreadthFirstSearch::BitboardBreadthFirstSearch(std::shared_ptr<const GridGraph> graph) :
+	_graph(graph),
+	_wordsPerRow(graph->wordsPerRow()),
+	_firstNextWord(0),
+	_lastNextWord(0),
+	_distances(graph->numberOfNodes(), unreachable),
+	_numberOfLayers(0) {
+	const int width = _graph->width();
+	const std::vector<uint64_t>& blocked = _graph->blockedBits();
+
+	// free cells, padding bits at the end of every row are never free
+	uint64_t lastWordMask = (width & 63) == 0 ? ~uint64_t(0) : (uint64_t(1) << (width & 63)) - 1;
+	_free.resize(blocked.size());
+	for (size_t i = 0; i < blocked.size(); ++i) {
+		_free[i] = ~blocked[i];
+		if (static_cast<int>(i % _wordsPerRow) == _wordsPerRow - 1) {
+			_free[i] &= lastWordMask;
+		}
+	}
+
+	_visited.assign(blocked.size(), 0);
+
+	size_t paddedWords = static_cast<size_t>(_graph->height() + 2) * _wordsPerRow;
+	_frontier.assign(paddedWords, 0);
+	_next.assign(paddedWords, 0);
+	_stamps.assign(paddedWords, 0);
+	_horizontal.assign(_wordsPerRow, 0);
+}
+
+void BitboardBreadthFirstSearch::run(int stopNode) {
+	int startX = 0;
+	int startY = 0;
+	_graph->coordinates(_graph->startNode(), startX, startY);
+	if (_graph->isBlocked(startX, startY)) {
+		return;
+	}
+
+	uint64_t startBit = uint64_t(1) << (startX & 63);
+	int startWord = (startY + 1) * _wordsPerRow + (startX >> 6);
+	_visited[startWord - _wordsPerRow] |= startBit;
+	_frontier[startWord] = startBit;
+	_frontierWords.push_back(startWord);
+	_distances[_graph->startNode()] = 0;
+	_numberOfLayers = 1;
+
+	// rows holding frontier words, the next layer can only grow one row up and down
+	int firstRow = startY;
+	int lastRow = startY;
+
+	bool found = stopNode == _graph->startNode();
+	for (uint32_t layer = 1; !found && !_frontierWords.empty(); ++layer) {
+		firstRow = std::max(firstRow - 1, 0);
+		lastRow = std::min(lastRow + 1, _graph->height() - 1);
+		_firstNextWord = static_cast<int>(_next.size());
+		_lastNextWord = -1;
+
+		// sparse mode looks at 3 to 5 words per frontier word
+		size_t denseWords = static_cast<size_t>(lastRow - firstRow + 1) * _wordsPerRow;
+		if (_frontierWords.size() * 5 < denseWords) {
+			found = expandSparse(layer, stopNode);
+		}
+		else {
+			found = expandDense(layer, firstRow, lastRow, stopNode);
+		}
+
+		// clear the old frontier so both buffers are empty but for the new frontier
+		for (int word : _frontierWords) {
+			_frontier[word] = 0;
+		}
+		_frontier.swap(_next);
+		_frontierWords.swap(_nextWords);
+		_nextWords.clear();
+
+		if (!_frontierWords.empty()) {
+			_numberOfLayers = layer + 1;
+
+			firstRow = rowOf(_firstNextWord);
+			lastRow = rowOf(_lastNextWord);
+		}
+	}
+}
+
+std::vector<int> BitboardBreadthFirstSearch::parents()const {
+	std::vector<int> result(_distances.size(), -1);
+	for (int node = 0; node < static_cast<int>(_distances.size()); ++node) {
+		if (_distances[node] != unreachable && _distances[node] != 0) {
+			result[node] = parentOf(node);
+		}
+	}
+
+	return result;
+}
+
+std::vector<int> BitboardBreadthFirstSearch::path(int node)const {
+	std::vector<int> result;
+	if (_distances[node] == unreachable) {
+		return result;
+	}
+
+	result.resize(_distances[node] + 1);
+	for (int i = static_cast<int>(result.size()) - 1; i >= 0; --i) {
+		result[i] = node;
+		if (i > 0) {
+			node = parentOf(node);
+		}
+	}
+
+	return result;
+}
+
+int BitboardBreadthFirstSearch::parentOf(int node)const {
+	IGraph::NeighborBuffer buffer;
+	uint32_t previous = _distances[node] - 1;
+	for (int adjNode : _graph->neighbors(node, buffer)) {
+		if (_distances[adjNode] == previous) {
+			return adjNode;
+		}
+	}
+
+	return -1;
+}
+
+bool BitboardBreadthFirstSearch::expandSparse(uint32_t layer, int stopNode) {
+	const int rowWords = _wordsPerRow;
+	const int height = _graph->height();
+
+	bool found = false;
+	for (int word : _frontierWords) {
+		int w = word % rowWords;
+		int y = rowOf(word);
+
+		// the cells of a frontier word reach its own word, the words above and below
+		// and the words on the sides only through their first / last bit
+		uint64_t current = _frontier[word];
+		found = expandWord(word, layer, stopNode) || found;
+		if (w > 0 && (current & 1) != 0) {
+			found = expandWord(word - 1, layer, stopNode) || found;
+		}
+		if (w + 1 < rowWords && (current >> 63) != 0) {
+			found = expandWord(word + 1, layer, stopNode) || found;
+		}
+		if (y > 0) {
+			found = expandWord(word - rowWords, layer, stopNode) || found;
+		}
+		if (y + 1 < height) {
+			found = expandWord(word + rowWords, layer, stopNode) || found;
+		}
+	}
+
+	return found;
+}
+
+bool BitboardBreadthFirstSearch::expandWord(int word, uint32_t layer, int stopNode) {
+	if (_stamps[word] == layer) {
+		// already expanded in this layer
+		return false;
+	}
+	_stamps[word] = layer;
+
+	const int rowWords = _wordsPerRow;
+	int w = word % rowWords;
+
+	uint64_t current = _frontier[word];
+	uint64_t reached = (current << 1) | (current >> 1) | _frontier[word - rowWords] | _frontier[word + rowWords];
+	if (w > 0) {
+		reached |= _frontier[word - 1] >> 63;
+	}
+	if (w + 1 < rowWords) {
+		reached |= _frontier[word + 1] << 63;
+	}
+
+	int gridWord = word - rowWords;
+	uint64_t newCells = reached & _free[gridWord] & ~_visited[gridWord];
+	if (newCells == 0) {
+		return false;
+	}
+
+	_visited[gridWord] |= newCells;
+	_next[word] = newCells;
+	pushNextWord(word);
+
+	return recordWord(word, newCells, layer, stopNode);
+}
+
+bool BitboardBreadthFirstSearch::expandDense(uint32_t layer, int firstRow, int lastRow, int stopNode) {
+	const int rowWords = _wordsPerRow;
+
+	bool found = false;
+	for (int y = firstRow; y <= lastRow; ++y) {
+		const uint64_t* row = &_frontier[(y + 1) * rowWords];
+		const uint64_t* above = row - rowWords;
+		const uint64_t* below = row + rowWords;
+		const uint64_t* freeRow = &_free[y * rowWords];
+		uint64_t* visitedRow = &_visited[y * rowWords];
+		uint64_t* nextRow = &_next[(y + 1) * rowWords];
+
+		// left and right neighbors: shift the whole row one bit, carrying between words
+		for (int w = 0; w < rowWords; ++w) {
+			uint64_t word = row[w];
+			uint64_t fromLeft = (word << 1) | (w > 0 ? row[w - 1] >> 63 : 0);
+			uint64_t fromRight = (word >> 1) | (w + 1 < rowWords ? row[w + 1] << 63 : 0);
+			_horizontal[w] = fromLeft | fromRight;
+		}
+
+		int w = 0;
+#if defined(__AVX2__)
+		for (; w + 4 <= rowWords; w += 4) {
+			__m256i reached = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&_horizontal[w])),
+				_mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(above + w)),
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + w))));
+			__m256i visited = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(visitedRow + w));
+			__m256i newCells = _mm256_andnot_si256(visited,
+				_mm256_and_si256(reached, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(freeRow + w))));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(nextRow + w), newCells);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(visitedRow + w), _mm256_or_si256(visited, newCells));
+		}
+#endif
+		for (; w < rowWords; ++w) {
+			uint64_t newCells = (_horizontal[w] | above[w] | below[w]) & freeRow[w] & ~visitedRow[w];
+			nextRow[w] = newCells;
+			visitedRow[w] |= newCells;
+		}
+
+		for (w = 0; w < rowWords; ++w) {
+			if (nextRow[w] != 0) {
+				int word = (y + 1) * rowWords + w;
+				pushNextWord(word);
+				found = recordWord(word, nextRow[w], layer, stopNode) || found;
+			}
+		}
+	}
+
+	return found;
+}
+
+void BitboardBreadthFirstSearch::pushNextWord(int word) {
+	_nextWords.push_back(word);
+	_firstNextWord = std::min(_firstNextWord, word);
+	_lastNextWord = std::max(_lastNextWord, word);
+}
+
+bool BitboardBreadthFirstSearch::recordWord(int word, uint64_t bits, uint32_t layer, int stopNode) {
+	bool found = false;
+	int rowStart = rowOf(word) * _graph->width() + ((word % _wordsPerRow) << 6);
+	while (bits != 0) {
+		int node = rowStart + GridGraph::lowestBit(bits);
+		_distances[node] = layer;
+		found = found || node == stopNode;
+		bits &= bits - 1;
+	}
+
+	return found;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "GridGraph.h"
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+// Breadth first search over a 4-connected GridGraph that expands 64 cells per word operation.
+// Frontier, visited set and free cells are packed bitboards (same layout as the GridGraph
+// obstacle bitmap: 64 cells per word, rows padded to whole words), so one layer of the search is
+//	next = (frontier << 1 | frontier >> 1 | frontier up | frontier down) & free & ~visited
+// Every layer is computed either
+//	- sparse: only the words around the non empty frontier words, or
+//	- dense: whole rows between the first and last frontier rows (4 words per AVX2 instruction when enabled)
+// whichever touches fewer words. The AVX2 path is compiled when __AVX2__ is defined (/arch:AVX2, -mavx2).
+// Only the distance of every reached cell is recorded, parents are rebuilt from the distance layers.
+class BitboardBreadthFirstSearch
+{
+public:
+	static constexpr uint32_t unreachable = 0xFFFFFFFFu;
+
+	BitboardBreadthFirstSearch(std::shared_ptr<const GridGraph> graph);
+	~BitboardBreadthFirstSearch() = default;
+
+	// expands layers from the start node until every reachable cell has a distance,
+	// or until stopNode gets its distance (when stopNode >= 0). Call it once per object.
+	void run(int stopNode = -1);
+
+	uint32_t distance(int node)const { return _distances[node]; }
+	const std::vector<uint32_t>& distances()const { return _distances; }
+
+	int numberOfLayers()const { return _numberOfLayers; }
+
+	// parent of every reached node (-1 for the start node and unreached nodes), same format as IShortestPathStrategy::parents
+	// a parent is the first neighbor (top, bottom, left, right) lying on the previous layer
+	std::vector<int> parents()const;
+
+	// cells from start to node (both included), empty if node was not reached
+	std::vector<int> path(int node)const;
+private:
+	// word indices below refer to the frontier buffers, which have an empty row above and below the grid
+	int rowOf(int word)const { return word / _wordsPerRow - 1; }
+
+	int parentOf(int node)const;
+	bool expandSparse(uint32_t layer, int stopNode);
+	bool expandDense(uint32_t layer, int firstRow, int lastRow, int stopNode);
+	bool expandWord(int word, uint32_t layer, int stopNode);
+	void pushNextWord(int word);
+	bool recordWord(int word, uint64_t bits, uint32_t layer, int stopNode);
+
+	std::shared_ptr<const GridGraph> _graph;
+	int _wordsPerRow;
+	std::vector<uint64_t> _free;
+	std::vector<uint64_t> _visited;
+	std::vector<uint64_t> _frontier;
+	std::vector<uint64_t> _next;
+	std::vector<int> _frontierWords;	// non empty words of _frontier
+	std::vector<int> _nextWords;		// non empty words of _next
+	int _firstNextWord;					// smallest and largest word in _nextWords
+	int _lastNextWord;
+	std::vector<uint32_t> _stamps;		// last layer that expanded each word (sparse mode)
+	std::vector<uint64_t> _horizontal;	// scratch row for the left / right neighbors (dense mode)
+	std::vector<uint32_t> _distances;
+	int _numberOfLayers;
+};
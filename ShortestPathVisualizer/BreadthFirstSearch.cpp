@@ -0,0 +1,91 @@
+#include "BreadthFirstSearch.h"
+
+#include "IGraph.h"
+#include "SearchStatistics.h"
+
+#include <assert.h>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+BreadthFirstSearch::BreadthFirstSearch(std::shared_ptr<const IGraph> graph, size_t capacity) :
+	IShortestPathStrategy(capacity),
+	_graph(graph),
+	_visited((capacity + 63) >> 6, 0),
+	_queue(capacity > 0 ? capacity : 1),
+	_head(0),
+	_count(0) {
+	assert(_graph->hasUniformEdgeWeights());
+	markVisited(_graph->startNode());
+	push(_graph->startNode());
+}
+
+int BreadthFirstSearch::step() {
+	if (_count == 0) {
+		//no more nodes
+		return -1;
+	}
+
+	SearchCounters::ExpansionTimer timer(_counters);
+	int node = pop();
+	if (node == _graph->endNode()) {
+		// I found the end node, therefore finish (emptying the queue, so later calls don't search on)
+		_count = 0;
+		return -1;
+	}
+
+	_counters.expanded();
+	for (int adjNode : _graph->neighbors(node, _neighborBuffer)) {
+		_counters.generated();
+		// the first time a node is discovered is through a shortest path
+		if (!isVisited(adjNode)) {
+			markVisited(adjNode);
+			_parents[adjNode] = node;
+			push(adjNode);
+		}
+	}
+
+	return node;
+}
+
+SearchResult BreadthFirstSearch::solve() {
+	while (step() != -1) {
+	}
+
+	SearchResult result = makeResult(_graph->startNode(), _graph->endNode(), 0.0f);
+	if (!result.path.empty()) {
+		// every edge has weight 1
+		result.distance = static_cast<float>(result.path.size() - 1);
+	}
+
+	return result;
+}
+
+void BreadthFirstSearch::push(int node) {
+	assert(_count < _queue.size());
+	SearchCounters::QueueTimer timer(_counters);
+
+	size_t tail = _head + _count;
+	if (tail >= _queue.size()) {
+		tail -= _queue.size();
+	}
+
+	_queue[tail] = node;
+	++_count;
+	_counters.inserted(_count);
+}
+
+int BreadthFirstSearch::pop() {
+	assert(_count > 0);
+	SearchCounters::QueueTimer timer(_counters);
+	_counters.popped();
+
+	int node = _queue[_head];
+	++_head;
+	if (_head == _queue.size()) {
+		_head = 0;
+	}
+	--_count;
+
+	return node;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "IShortestPathStrategy.h"
+
+#include "IGraph.h"
+#include "SearchStatistics.h"
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+// Breadth first search, when every edge has the same weight it finds the same
+// distances as Dijkstra without any priority queue: nodes are expanded in FIFO order
+// from a flat ring buffer and discovered nodes are marked in a bitset.
+// Only for graphs with unit edge weights (asserted), WeightedDijkstra follows terrain costs.
+class BreadthFirstSearch :
+    public IShortestPathStrategy
+{
+public:
+	BreadthFirstSearch(std::shared_ptr<const IGraph> graph, size_t capacity);
+
+	virtual ~BreadthFirstSearch() = default;
+
+	int step() override final;
+	SearchResult solve() override final;
+	// decreaseKeys and reopenings stay 0, a FIFO queue has neither
+	SearchStatistics statistics()const override final { return _counters.statistics(); }
+private:
+	bool isVisited(int node)const { return ((_visited[node >> 6] >> (node & 63)) & 1) != 0; }
+	void markVisited(int node) { _visited[node >> 6] |= uint64_t(1) << (node & 63); }
+
+	void push(int node);
+	int pop();
+
+	std::shared_ptr<const IGraph> _graph;
+	std::vector<uint64_t> _visited;
+	// ring buffer, every node is pushed at most once so it never holds more than capacity nodes
+	std::vector<int> _queue;
+	size_t _head;
+	size_t _count;
+	IGraph::NeighborBuffer _neighborBuffer;
+	SearchCounters _counters;
+};
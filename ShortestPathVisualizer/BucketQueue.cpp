@@ -0,0 +1,115 @@
+#include "BucketQueue.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <vector>
+
+BucketQueue::BucketQueue(size_t capacity, int maxKeyIncrease) :
+	_keys(capacity, 0),
+	_slots(capacity, -1),
+	_minKey(0),
+	_windowStart(0),
+	_size(0) {
+	assert(maxKeyIncrease >= 0);
+
+	// keys span at most maxKeyIncrease + 1 consecutive values,
+	// round up to a power of two so the bucket is found with a mask
+	uint32_t numberOfBuckets = 1;
+	while (numberOfBuckets < static_cast<uint32_t>(maxKeyIncrease) + 1) {
+		numberOfBuckets <<= 1;
+	}
+
+	_buckets.resize(numberOfBuckets);
+	_mask = numberOfBuckets - 1;
+}
+
+void BucketQueue::insert(int node, uint32_t k) {
+	assert(_slots[node] < 0);
+
+	if (_size == 0) {
+		if (k < _windowStart || k - _windowStart > _mask) {
+			// the key does not fit the current window (e.g. first insertion), start a new one from it
+			_windowStart = k;
+		}
+		_minKey = k;
+	}
+	else if (k < _minKey) {
+		_minKey = k;
+	}
+	assert(k >= _windowStart && k - _windowStart <= _mask);
+
+	add(node, k);
+}
+
+void BucketQueue::decreaseKey(int node, uint32_t k) {
+	assert(_slots[node] >= 0);
+	assert(k <= _keys[node] && k >= _windowStart);
+
+	remove(node);
+	if (_size == 0 || k < _minKey) {
+		_minKey = k;
+	}
+
+	add(node, k);
+}
+
+int BucketQueue::top()const {
+	assert(_size > 0);
+
+	return bucket(_minKey).back();
+}
+
+float BucketQueue::topKey()const {
+	assert(_size > 0);
+
+	return static_cast<float>(_minKey);
+}
+
+void BucketQueue::pop() {
+	assert(_size > 0);
+
+	_windowStart = _minKey;
+	remove(bucket(_minKey).back());
+
+	if (_size > 0) {
+		//the keys left are in the window, walk forward until a non empty bucket
+		while (bucket(_minKey).empty()) {
+			++_minKey;
+		}
+	}
+}
+
+void BucketQueue::clear() {
+	for (auto& b : _buckets) {
+		for (int node : b) {
+			_slots[node] = -1;
+		}
+		b.clear();
+	}
+
+	_minKey = 0;
+	_windowStart = 0;
+	_size = 0;
+}
+
+void BucketQueue::add(int node, uint32_t key) {
+	std::vector<int>& b = bucket(key);
+	_keys[node] = key;
+	_slots[node] = static_cast<int>(b.size());
+	b.push_back(node);
+	++_size;
+}
+
+void BucketQueue::remove(int node) {
+	std::vector<int>& b = bucket(_keys[node]);
+	int slot = _slots[node];
+
+	// move the last node of the bucket into the hole
+	int last = b.back();
+	b[slot] = last;
+	_slots[last] = slot;
+	b.pop_back();
+
+	_slots[node] = -1;
+	--_size;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Dial's bucket queue for monotone integer keys (unit or small integer edge costs).
+// Keys are kept in a circular array of buckets indexed by key; every key in the queue
+// must lie in [lastPoppedKey, lastPoppedKey + maxKeyIncrease] (or start a new window when the
+// queue is empty) which makes every operation O(1)
+// (pop amortized, it only walks over empty buckets while the minimum moves forward).
+// Keys are uint32_t (KeyType), the float overloads are kept for the searches with float costs
+// and must be given integer values.
+class BucketQueue
+{
+public:
+	typedef uint32_t KeyType;
+
+	// maximum difference between an inserted key and the last popped one,
+	// unit edge costs need 1 for Dijkstra and 2 for A* with Manhattan distance,
+	// the default leaves room for small integer edge costs
+	static const int defaultMaxKeyIncrease = 15;
+
+	BucketQueue(size_t capacity, int maxKeyIncrease = defaultMaxKeyIncrease);
+	~BucketQueue() = default;
+
+	void insert(int node, uint32_t key);
+	void decreaseKey(int node, uint32_t key);
+	void insert(int node, float key) { insert(node, toIntegerKey(key)); }
+	void decreaseKey(int node, float key) { decreaseKey(node, toIntegerKey(key)); }
+
+	int top()const;
+	float topKey()const;
+	void pop();
+	// empties the queue, O(size + buckets)
+	void clear();
+
+	bool isEmpty()const { return _size == 0; }
+	size_t size()const { return _size; }
+	int numberOfBuckets()const { return static_cast<int>(_buckets.size()); }
+private:
+	static uint32_t toIntegerKey(float key) {
+		assert(key >= 0.0f && static_cast<float>(static_cast<uint32_t>(key)) == key);
+		return static_cast<uint32_t>(key);
+	}
+
+	std::vector<int>& bucket(uint32_t key) { return _buckets[key & _mask]; }
+	const std::vector<int>& bucket(uint32_t key)const { return _buckets[key & _mask]; }
+
+	void add(int node, uint32_t key);
+	void remove(int node);
+
+	std::vector<std::vector<int>> _buckets;
+	uint32_t _mask;
+	std::vector<uint32_t> _keys;	// key of every node in the queue
+	std::vector<int> _slots;		// position of every node inside its bucket
+	uint32_t _minKey;				// key of the first non empty bucket (when not empty)
+	uint32_t _windowStart;			// last popped key (first possible key in the queue)
+	size_t _size;
+};
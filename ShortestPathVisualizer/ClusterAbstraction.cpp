@@ -0,0 +1,346 @@
+#include "ClusterAbstraction.h"
+
+#include "GridGraph.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <memory>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace {
+	// free stretches of a border at least this long get an entrance at each end instead of one in the middle
+	const int longEntrance = 6;
+}
+
+ClusterAbstraction::ClusterAbstraction(std::shared_ptr<const GridGraph> graph, int clusterSize) :
+	_graph(graph),
+	_clusterSize(clusterSize),
+	_clustersX((graph->width() + clusterSize - 1) / clusterSize),
+	_clustersY((graph->height() + clusterSize - 1) / clusterSize),
+	_eastTransitions(_clustersX * _clustersY),
+	_southTransitions(_clustersX * _clustersY),
+	_clusters(_clustersX * _clustersY),
+	_eastInvalid(_clustersX * _clustersY, true),
+	_southInvalid(_clustersX * _clustersY, true),
+	_clusterInvalid(_clustersX * _clustersY, true),
+	_invalid(true),
+	_buildMilliseconds(0.0),
+	_updateMilliseconds(0.0) {
+	assert(clusterSize > 0 && clusterSize <= 64);
+	assert(graph->hasUniformEdgeWeights());
+	update();
+	_buildMilliseconds = _updateMilliseconds;
+}
+
+void ClusterAbstraction::clusterBounds(int cluster, int& left, int& top, int& right, int& bottom)const {
+	left = (cluster % _clustersX) * _clusterSize;
+	top = (cluster / _clustersX) * _clusterSize;
+	right = std::min(left + _clusterSize, _graph->width());
+	bottom = std::min(top + _clusterSize, _graph->height());
+}
+
+void ClusterAbstraction::distancesInCluster(int cell, std::vector<int>& distances)const {
+	int left = 0;
+	int top = 0;
+	int right = 0;
+	int bottom = 0;
+	int x = 0;
+	int y = 0;
+	_graph->coordinates(cell, x, y);
+	clusterBounds(cluster(x, y), left, top, right, bottom);
+	int height = bottom - top;
+
+	distances.assign(_clusterSize * _clusterSize, -1);
+
+	// breadth first search a whole level at a time, one word per row of the cluster
+	uint64_t free[64];
+	uint64_t visited[64];
+	uint64_t frontier[64];
+	uint64_t next[64];
+	for (int row = 0; row < height; ++row) {
+		free[row] = freeBits(top + row, left, right - left);
+		visited[row] = 0;
+		frontier[row] = 0;
+	}
+	frontier[y - top] = visited[y - top] = uint64_t(1) << (x - left);
+	distances[(x - left) + (y - top) * _clusterSize] = 0;
+
+	for (int distance = 1; ; ++distance) {
+		bool reached = false;
+		for (int row = 0; row < height; ++row) {
+			uint64_t around = (frontier[row] << 1) | (frontier[row] >> 1) |
+				(row > 0 ? frontier[row - 1] : 0) | (row + 1 < height ? frontier[row + 1] : 0);
+			next[row] = around & free[row] & ~visited[row];
+			reached = reached || next[row] != 0;
+		}
+		if (!reached) {
+			break;
+		}
+
+		for (int row = 0; row < height; ++row) {
+			frontier[row] = next[row];
+			visited[row] |= next[row];
+			for (uint64_t bits = next[row]; bits != 0; bits &= bits - 1) {
+				distances[GridGraph::lowestBit(bits) + row * _clusterSize] = distance;
+			}
+		}
+	}
+}
+
+void ClusterAbstraction::setGraph(std::shared_ptr<const GridGraph> graph) {
+	assert(graph->hasUniformEdgeWeights());
+	_graph = graph;
+}
+
+void ClusterAbstraction::invalidate(int x, int y) {
+	int left = 0;
+	int top = 0;
+	int right = 0;
+	int bottom = 0;
+	int invalidCluster = cluster(x, y);
+	clusterBounds(invalidCluster, left, top, right, bottom);
+
+	_invalid = true;
+	_clusterInvalid[invalidCluster] = true;
+
+	// a tile on the edge of the cluster can change the entrances shared with the cluster on the other side
+	if (x == right - 1 && right < _graph->width()) {
+		_eastInvalid[invalidCluster] = true;
+		_clusterInvalid[invalidCluster + 1] = true;
+	}
+	if (x == left && left > 0) {
+		_eastInvalid[invalidCluster - 1] = true;
+		_clusterInvalid[invalidCluster - 1] = true;
+	}
+	if (y == bottom - 1 && bottom < _graph->height()) {
+		_southInvalid[invalidCluster] = true;
+		_clusterInvalid[invalidCluster + _clustersX] = true;
+	}
+	if (y == top && top > 0) {
+		_southInvalid[invalidCluster - _clustersX] = true;
+		_clusterInvalid[invalidCluster - _clustersX] = true;
+	}
+}
+
+int ClusterAbstraction::update() {
+	auto begin = std::chrono::steady_clock::now();
+
+	int updated = 0;
+	if (_invalid) {
+		// borders first, the entrances of the clusters are on them
+		for (int cluster = 0; cluster < numberOfClusters(); ++cluster) {
+			if (_eastInvalid[cluster]) {
+				buildBorder(cluster, true);
+				_eastInvalid[cluster] = false;
+			}
+			if (_southInvalid[cluster]) {
+				buildBorder(cluster, false);
+				_southInvalid[cluster] = false;
+			}
+		}
+
+		// the edges of a cluster need the nodes of the clusters around it
+		for (int cluster = 0; cluster < numberOfClusters(); ++cluster) {
+			if (_clusterInvalid[cluster]) {
+				buildEntrances(cluster);
+			}
+		}
+		for (int cluster = 0; cluster < numberOfClusters(); ++cluster) {
+			if (_clusterInvalid[cluster]) {
+				buildEdges(cluster);
+				_clusterInvalid[cluster] = false;
+				++updated;
+			}
+		}
+
+		_invalid = false;
+	}
+
+	auto end = std::chrono::steady_clock::now();
+	_updateMilliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+
+	return updated;
+}
+
+void ClusterAbstraction::buildBorder(int cluster, bool east) {
+	std::vector<Transition>& transitions = east ? _eastTransitions[cluster] : _southTransitions[cluster];
+	transitions.clear();
+
+	int left = 0;
+	int top = 0;
+	int right = 0;
+	int bottom = 0;
+	clusterBounds(cluster, left, top, right, bottom);
+	if ((east && right == _graph->width()) || (!east && bottom == _graph->height())) {
+		// no cluster on the other side
+		return;
+	}
+
+	// tile i of the border is (x, y) on this side and (x + dx, y + dy) on the other one
+	int x = east ? right - 1 : left;
+	int y = east ? top : bottom - 1;
+	int dx = east ? 1 : 0;
+	int dy = east ? 0 : 1;
+	int length = east ? bottom - top : right - left;
+
+	int stretchBegin = -1;
+	for (int i = 0; i <= length; ++i) {
+		int borderX = x + (east ? 0 : i);
+		int borderY = y + (east ? i : 0);
+		bool free = i < length && !_graph->isBlocked(borderX, borderY) && !_graph->isBlocked(borderX + dx, borderY + dy);
+
+		if (free && stretchBegin < 0) {
+			stretchBegin = i;
+		}
+		else if (!free && stretchBegin >= 0) {
+			int stretch = i - stretchBegin;
+			int entrances[2] = { stretchBegin + stretch / 2, -1 };
+			if (stretch >= longEntrance) {
+				entrances[0] = stretchBegin;
+				entrances[1] = i - 1;
+			}
+
+			for (int entrance : entrances) {
+				if (entrance >= 0) {
+					int cellX = x + (east ? 0 : entrance);
+					int cellY = y + (east ? entrance : 0);
+					transitions.push_back(std::make_pair(_graph->index(cellX, cellY), _graph->index(cellX + dx, cellY + dy)));
+				}
+			}
+			stretchBegin = -1;
+		}
+	}
+}
+
+void ClusterAbstraction::buildEntrances(int cluster) {
+	std::vector<int> entrances;
+
+	// own side of the east and south borders, other side of the borders of the clusters on the left and above
+	for (const Transition& transition : _eastTransitions[cluster]) {
+		entrances.push_back(transition.first);
+	}
+	for (const Transition& transition : _southTransitions[cluster]) {
+		entrances.push_back(transition.first);
+	}
+	if (cluster % _clustersX > 0) {
+		for (const Transition& transition : _eastTransitions[cluster - 1]) {
+			entrances.push_back(transition.second);
+		}
+	}
+	if (cluster >= _clustersX) {
+		for (const Transition& transition : _southTransitions[cluster - _clustersX]) {
+			entrances.push_back(transition.second);
+		}
+	}
+
+	// a corner tile can be an entrance of two borders
+	std::sort(entrances.begin(), entrances.end());
+	entrances.erase(std::unique(entrances.begin(), entrances.end()), entrances.end());
+
+	Cluster& current = _clusters[cluster];
+	for (size_t i = 0; i < current.entrances.size(); ++i) {
+		if (!std::binary_search(entrances.begin(), entrances.end(), current.entrances[i])) {
+			int node = current.nodes[i];
+			_cells[node] = -1;
+			_clusterOfNode[node] = -1;
+			_edges[node].clear();
+			_freeNodes.push_back(node);
+		}
+	}
+
+	std::vector<int> nodes;
+	for (int entrance : entrances) {
+		auto old = std::lower_bound(current.entrances.begin(), current.entrances.end(), entrance);
+		bool kept = old != current.entrances.end() && *old == entrance;
+		nodes.push_back(kept ? current.nodes[old - current.entrances.begin()] : allocateNode(cluster, entrance));
+	}
+
+	current.entrances.swap(entrances);
+	current.nodes.swap(nodes);
+}
+
+void ClusterAbstraction::buildEdges(int cluster) {
+	const Cluster& current = _clusters[cluster];
+
+	int left = 0;
+	int top = 0;
+	int right = 0;
+	int bottom = 0;
+	clusterBounds(cluster, left, top, right, bottom);
+
+	// paths inside the cluster
+	std::vector<int> distances;
+	for (size_t from = 0; from < current.entrances.size(); ++from) {
+		std::vector<Edge>& edges = _edges[current.nodes[from]];
+		edges.clear();
+		distancesInCluster(current.entrances[from], distances);
+
+		for (size_t to = 0; to < current.entrances.size(); ++to) {
+			int x = 0;
+			int y = 0;
+			_graph->coordinates(current.entrances[to], x, y);
+			int distance = distances[(x - left) + (y - top) * _clusterSize];
+			if (from != to && distance > 0) {
+				edges.push_back(Edge{ current.nodes[to], distance });
+			}
+		}
+	}
+
+	// steps to the clusters around, the edges back are added by those clusters
+	for (const Transition& transition : _eastTransitions[cluster]) {
+		_edges[entranceNode(cluster, transition.first)].push_back(Edge{ entranceNode(cluster + 1, transition.second), 1 });
+	}
+	for (const Transition& transition : _southTransitions[cluster]) {
+		_edges[entranceNode(cluster, transition.first)].push_back(Edge{ entranceNode(cluster + _clustersX, transition.second), 1 });
+	}
+	if (cluster % _clustersX > 0) {
+		for (const Transition& transition : _eastTransitions[cluster - 1]) {
+			_edges[entranceNode(cluster, transition.second)].push_back(Edge{ entranceNode(cluster - 1, transition.first), 1 });
+		}
+	}
+	if (cluster >= _clustersX) {
+		for (const Transition& transition : _southTransitions[cluster - _clustersX]) {
+			_edges[entranceNode(cluster, transition.second)].push_back(Edge{ entranceNode(cluster - _clustersX, transition.first), 1 });
+		}
+	}
+}
+
+int ClusterAbstraction::allocateNode(int cluster, int cell) {
+	int node = 0;
+	if (_freeNodes.empty()) {
+		node = numberOfNodes();
+		_cells.push_back(cell);
+		_clusterOfNode.push_back(cluster);
+		_edges.push_back(std::vector<Edge>());
+	}
+	else {
+		node = _freeNodes.back();
+		_freeNodes.pop_back();
+		_cells[node] = cell;
+		_clusterOfNode[node] = cluster;
+	}
+
+	return node;
+}
+
+int ClusterAbstraction::entranceNode(int cluster, int cell)const {
+	const Cluster& current = _clusters[cluster];
+	return current.nodes[std::lower_bound(current.entrances.begin(), current.entrances.end(), cell) - current.entrances.begin()];
+}
+
+uint64_t ClusterAbstraction::freeBits(int y, int left, int width)const {
+	const uint64_t* row = _graph->blockedBits().data() + static_cast<size_t>(y) * _graph->wordsPerRow();
+	int word = left >> 6;
+	int shift = left & 63;
+
+	uint64_t blocked = row[word] >> shift;
+	if (shift != 0 && shift + width > 64) {
+		blocked |= row[word + 1] << (64 - shift);
+	}
+
+	uint64_t mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+	return ~blocked & mask;
+}
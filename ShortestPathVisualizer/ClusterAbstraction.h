@@ -0,0 +1,93 @@
+#pragma once
+
+#include "GridGraph.h"
+
+#include <memory>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+// HPA* abstraction (Botea, Muller & Schaeffer) of a GridGraph: the grid is split in square clusters,
+// every free stretch of the border between two clusters gets one entrance (two, at its ends, when it
+// is long), and the distances between the entrances of a cluster are computed walking inside it.
+// The entrances and those distances form a small abstract graph that HierarchicalAStar searches
+// instead of the grid. The distances count moves, so the grid can't have terrain costs (asserted).
+// When tiles change, invalidate() marks the borders and clusters they touch and update() recomputes
+// only those. An entrance keeps its node while its tile stays an entrance, so the rest of the abstract
+// graph is not touched; freed nodes are reused by later entrances.
+class ClusterAbstraction
+{
+public:
+	struct Edge {
+		int target;		// abstract node
+		int weight;
+	};
+
+	// clusterSize is at most 64, a row of a cluster is searched as one 64 bit word
+	ClusterAbstraction(std::shared_ptr<const GridGraph> graph, int clusterSize);
+
+	int clusterSize()const { return _clusterSize; }
+	int numberOfClusters()const { return _clustersX * _clustersY; }
+	int cluster(int x, int y)const { return x / _clusterSize + (y / _clusterSize) * _clustersX; }
+	// tiles of cluster, right and bottom excluded (clusters on the right and bottom edges can be smaller)
+	void clusterBounds(int cluster, int& left, int& top, int& right, int& bottom)const;
+
+	// abstract graph, nodes of entrances removed by an update stay unused (cell -1, no edges) until reused
+	int numberOfNodes()const { return static_cast<int>(_cells.size()); }
+	int numberOfEntrances()const { return numberOfNodes() - static_cast<int>(_freeNodes.size()); }
+	int cell(int node)const { return _cells[node]; }
+	int clusterOfNode(int node)const { return _clusterOfNode[node]; }
+	const std::vector<Edge>& edges(int node)const { return _edges[node]; }
+	// entrances of cluster as abstract nodes, sorted by tile
+	const std::vector<int>& nodes(int cluster)const { return _clusters[cluster].nodes; }
+
+	// distances from cell to the tiles of its cluster walking only inside it (-1 if it can't reach them),
+	// indexed (x - left) + (y - top) * clusterSize
+	void distancesInCluster(int cell, std::vector<int>& distances)const;
+
+	// graph replaces the grid (same size and tiles, except the ones passed to invalidate)
+	void setGraph(std::shared_ptr<const GridGraph> graph);
+	// tile (x, y) was blocked or cleared, it is recomputed by the next update()
+	void invalidate(int x, int y);
+	// recomputes the borders and clusters invalidated since the last update, returns how many clusters
+	int update();
+
+	// metrics
+	double buildMilliseconds()const { return _buildMilliseconds; }
+	double updateMilliseconds()const { return _updateMilliseconds; }
+private:
+	typedef std::pair<int, int> Transition;	// (cell of a cluster, adjacent cell of the next one)
+
+	struct Cluster {
+		std::vector<int> entrances;		// cells, sorted
+		std::vector<int> nodes;			// abstract node of every entrance
+	};
+
+	// east borders are between a cluster and the one on its right, south borders with the one below
+	void buildBorder(int cluster, bool east);
+	// entrances of the cluster from its borders, keeping the nodes of the ones that were already there
+	void buildEntrances(int cluster);
+	void buildEdges(int cluster);
+	int allocateNode(int cluster, int cell);
+	int entranceNode(int cluster, int cell)const;
+	// free tiles of row y from x = left, bit i is tile left + i
+	uint64_t freeBits(int y, int left, int width)const;
+
+	std::shared_ptr<const GridGraph> _graph;
+	int _clusterSize;
+	int _clustersX;
+	int _clustersY;
+	std::vector<std::vector<Transition>> _eastTransitions;
+	std::vector<std::vector<Transition>> _southTransitions;
+	std::vector<Cluster> _clusters;
+	std::vector<bool> _eastInvalid;
+	std::vector<bool> _southInvalid;
+	std::vector<bool> _clusterInvalid;
+	bool _invalid;
+	std::vector<int> _cells;
+	std::vector<int> _clusterOfNode;
+	std::vector<std::vector<Edge>> _edges;
+	std::vector<int> _freeNodes;
+	double _buildMilliseconds;
+	double _updateMilliseconds;
+};
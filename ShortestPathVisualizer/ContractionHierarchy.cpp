@@ -0,0 +1,261 @@
+#include "ContractionHierarchy.h"
+
+#include "IGraph.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace {
+	typedef ContractionHierarchy::Edge Edge;
+	typedef std::pair<int, int> Entry;	// (key, node)
+	typedef std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> MinQueue;
+
+	const int infinite = std::numeric_limits<int>::max();
+	// witness searches give up after settling this many nodes (then a shortcut is added, which is always safe)
+	const int witnessSettleLimit = 64;
+
+	// graph being contracted, only edges between nodes not contracted yet are kept
+	class Contraction {
+	public:
+		Contraction(const IGraph& graph) :
+			_edges(graph.numberOfNodes()),
+			_contractedNeighbors(graph.numberOfNodes(), 0),
+			_witnessWeights(graph.numberOfNodes(), infinite) {
+			IGraph::NeighborBuffer buffer;
+			for (int node = 0; node < graph.numberOfNodes(); ++node) {
+				for (int adjacent : graph.neighbors(node, buffer)) {
+					addEdge(node, adjacent, 1, -1);
+				}
+			}
+		}
+
+		// edge difference (shortcuts added minus edges removed) plus the contracted neighbors,
+		// which spreads the contraction evenly over the graph
+		int priority(int node) {
+			int shortcuts = contract(node, false);
+			return shortcuts - static_cast<int>(_edges[node].size()) + _contractedNeighbors[node];
+		}
+
+		// adds the shortcuts needed to remove node, returns how many were (or would be) added
+		int contract(int node, bool apply) {
+			const std::vector<Edge>& edges = _edges[node];
+			int maxWeight = 0;
+			for (const Edge& edge : edges) {
+				maxWeight = std::max(maxWeight, edge.weight);
+			}
+
+			int shortcuts = 0;
+			for (size_t i = 0; i < edges.size(); ++i) {
+				const Edge& in = edges[i];
+				witnessSearch(in.target, node, in.weight + maxWeight);
+
+				for (size_t j = i + 1; j < edges.size(); ++j) {
+					const Edge& out = edges[j];
+					int weight = in.weight + out.weight;
+					if (_witnessWeights[out.target] > weight) {
+						// no path avoiding node is as short, the shortcut is needed
+						++shortcuts;
+						if (apply) {
+							_added.push_back(Edge{ out.target, weight, node });
+							_addedFrom.push_back(in.target);
+						}
+					}
+				}
+
+				resetWitness();
+			}
+
+			if (apply) {
+				for (size_t i = 0; i < _added.size(); ++i) {
+					addEdge(_addedFrom[i], _added[i].target, _added[i].weight, _added[i].middle);
+					addEdge(_added[i].target, _addedFrom[i], _added[i].weight, _added[i].middle);
+				}
+				_added.clear();
+				_addedFrom.clear();
+
+				// node leaves the graph
+				for (const Edge& edge : _edges[node]) {
+					removeEdge(edge.target, node);
+					++_contractedNeighbors[edge.target];
+				}
+			}
+
+			return shortcuts;
+		}
+
+		const std::vector<Edge>& edges(int node)const { return _edges[node]; }
+	private:
+		void addEdge(int from, int to, int weight, int middle) {
+			for (Edge& edge : _edges[from]) {
+				if (edge.target == to) {
+					if (weight < edge.weight) {
+						edge.weight = weight;
+						edge.middle = middle;
+					}
+					return;
+				}
+			}
+
+			_edges[from].push_back(Edge{ to, weight, middle });
+		}
+
+		void removeEdge(int from, int to) {
+			std::vector<Edge>& edges = _edges[from];
+			for (size_t i = 0; i < edges.size(); ++i) {
+				if (edges[i].target == to) {
+					edges[i] = edges.back();
+					edges.pop_back();
+					return;
+				}
+			}
+		}
+
+		// bounded Dijkstra from source that never goes through skipped
+		void witnessSearch(int source, int skipped, int maxWeight) {
+			// binary heap on a vector kept between searches (no allocation per search)
+			std::vector<Entry>& queue = _witnessQueue;
+			std::greater<Entry> compare;
+			queue.clear();
+
+			_witnessWeights[source] = 0;
+			_touched.push_back(source);
+			queue.push_back(Entry(0, source));
+
+			int settled = 0;
+			while (!queue.empty() && settled < witnessSettleLimit) {
+				std::pop_heap(queue.begin(), queue.end(), compare);
+				Entry entry = queue.back();
+				queue.pop_back();
+				if (entry.first > _witnessWeights[entry.second]) {
+					continue;
+				}
+				if (entry.first > maxWeight) {
+					break;
+				}
+				++settled;
+
+				for (const Edge& edge : _edges[entry.second]) {
+					int weight = entry.first + edge.weight;
+					if (edge.target != skipped && weight < _witnessWeights[edge.target]) {
+						if (_witnessWeights[edge.target] == infinite) {
+							_touched.push_back(edge.target);
+						}
+						_witnessWeights[edge.target] = weight;
+						queue.push_back(Entry(weight, edge.target));
+						std::push_heap(queue.begin(), queue.end(), compare);
+					}
+				}
+			}
+		}
+
+		void resetWitness() {
+			for (int node : _touched) {
+				_witnessWeights[node] = infinite;
+			}
+			_touched.clear();
+		}
+
+		std::vector<std::vector<Edge>> _edges;
+		std::vector<int> _contractedNeighbors;
+		std::vector<int> _witnessWeights;
+		std::vector<int> _touched;
+		std::vector<Entry> _witnessQueue;
+		std::vector<Edge> _added;
+		std::vector<int> _addedFrom;
+	};
+}
+
+ContractionHierarchy::ContractionHierarchy(std::shared_ptr<const IGraph> graph) :
+	_rank(graph->numberOfNodes(), -1),
+	_offsets(graph->numberOfNodes() + 1, 0),
+	_numberOfShortcuts(0),
+	_buildMilliseconds(0.0) {
+	assert(graph->hasUniformEdgeWeights());
+	auto begin = std::chrono::steady_clock::now();
+
+	int numberOfNodes = graph->numberOfNodes();
+	Contraction contraction(*graph);
+
+	// lazy updates: a node is only contracted if its priority is still the smallest when recomputed
+	MinQueue order;
+	for (int node = 0; node < numberOfNodes; ++node) {
+		order.push(Entry(contraction.priority(node), node));
+	}
+
+	// upward edges of every node, known when it is contracted (its remaining edges go to higher ranks)
+	std::vector<std::vector<Edge>> upwardEdges(numberOfNodes);
+	int nextRank = 0;
+	while (!order.empty()) {
+		int node = order.top().second;
+		order.pop();
+		if (_rank[node] >= 0) {
+			continue;
+		}
+
+		int priority = contraction.priority(node);
+		if (!order.empty() && priority > order.top().first) {
+			order.push(Entry(priority, node));
+			continue;
+		}
+
+		upwardEdges[node] = contraction.edges(node);
+		_rank[node] = nextRank++;
+		contraction.contract(node, true);
+	}
+
+	// flatten into CSR
+	for (int node = 0; node < numberOfNodes; ++node) {
+		_offsets[node + 1] = _offsets[node] + static_cast<int>(upwardEdges[node].size());
+	}
+	_upward.reserve(_offsets[numberOfNodes]);
+	for (int node = 0; node < numberOfNodes; ++node) {
+		for (const Edge& edge : upwardEdges[node]) {
+			_upward.push_back(edge);
+			if (edge.middle >= 0) {
+				++_numberOfShortcuts;
+			}
+		}
+	}
+
+	auto end = std::chrono::steady_clock::now();
+	_buildMilliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+void ContractionHierarchy::unpack(int from, int to, std::vector<int>& path)const {
+	// iterative, shortcuts of shortcuts can go deep
+	std::vector<std::pair<int, int>> pending(1, std::make_pair(from, to));
+	while (!pending.empty()) {
+		std::pair<int, int> edge = pending.back();
+		pending.pop_back();
+
+		int middle = findUpwardEdge(edge.first, edge.second)->middle;
+		if (middle < 0) {
+			path.push_back(edge.second);
+		}
+		else {
+			// first half on top, it is unpacked first
+			pending.push_back(std::make_pair(middle, edge.second));
+			pending.push_back(std::make_pair(edge.first, middle));
+		}
+	}
+}
+
+const ContractionHierarchy::Edge* ContractionHierarchy::findUpwardEdge(int from, int to)const {
+	// the edge is stored by its lower ranked end
+	int low = _rank[from] < _rank[to] ? from : to;
+	int high = low == from ? to : from;
+	for (const Edge& edge : upward(low)) {
+		if (edge.target == high) {
+			return &edge;
+		}
+	}
+
+	return nullptr;
+}
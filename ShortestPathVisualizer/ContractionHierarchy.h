@@ -0,0 +1,65 @@
+#pragma once
+
+#include "IGraph.h"
+
+#include <memory>
+#include <vector>
+
+// Contraction Hierarchies preprocessing (Geisberger et al.): nodes are contracted one by one from the
+// least to the most important, and a shortcut replaces every shortest path that went through the
+// contracted node. Afterwards a shortest path always goes up the hierarchy and then down, so a query
+// only needs the edges that go to higher ranked nodes (see ContractionHierarchyQuery).
+// Works on any undirected IGraph (Graph or GridGraph) whose edges all weigh 1 (asserted).
+// Since the graph is undirected the upward graph is also the downward graph read backwards,
+// so a single CSR serves both sides of the query.
+class ContractionHierarchy
+{
+public:
+	struct Edge {
+		int target;
+		int weight;
+		int middle;		// node the shortcut skips, -1 for an edge of the graph
+	};
+
+	class EdgeRange {
+	public:
+		EdgeRange(const Edge* first, const Edge* last) :
+			_first(first),
+			_last(last) {
+		}
+
+		const Edge* begin()const { return _first; }
+		const Edge* end()const { return _last; }
+	private:
+		const Edge* _first;
+		const Edge* _last;
+	};
+
+	ContractionHierarchy(std::shared_ptr<const IGraph> graph);
+
+	int numberOfNodes()const { return static_cast<int>(_rank.size()); }
+	int rank(int node)const { return _rank[node]; }
+
+	// edges from node to higher ranked nodes (shortcuts included)
+	EdgeRange upward(int node)const {
+		const Edge* first = _upward.data();
+		return EdgeRange(first + _offsets[node], first + _offsets[node + 1]);
+	}
+
+	// appends the nodes of the real path from one end of an upward edge to the other (from excluded)
+	void unpack(int from, int to, std::vector<int>& path)const;
+
+	// metrics
+	double buildMilliseconds()const { return _buildMilliseconds; }
+	size_t numberOfShortcuts()const { return _numberOfShortcuts; }
+	size_t numberOfUpwardEdges()const { return _upward.size(); }
+private:
+	const Edge* findUpwardEdge(int from, int to)const;
+
+	// _upward[_offsets[i]] ... _upward[_offsets[i+1]-1] are the upward edges of node i
+	std::vector<int> _rank;
+	std::vector<int> _offsets;
+	std::vector<Edge> _upward;
+	size_t _numberOfShortcuts;
+	double _buildMilliseconds;
+};
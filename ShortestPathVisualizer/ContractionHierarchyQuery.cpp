@@ -0,0 +1,123 @@
+#include "ContractionHierarchyQuery.h"
+
+#include "ContractionHierarchy.h"
+#include "DaryHeap.h"
+#include "IGraph.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+ContractionHierarchyQuery::ContractionHierarchyQuery(std::shared_ptr<const IGraph> graph, std::shared_ptr<const ContractionHierarchy> hierarchy, size_t capacity) :
+	IShortestPathStrategy(capacity),
+	_graph(graph),
+	_hierarchy(hierarchy),
+	_forward(capacity),
+	_backward(capacity),
+	_forwardTurn(true),
+	_finished(false),
+	_bestWeight(-1),
+	_meetingNode(-1) {
+	int start = _graph->startNode();
+	int end = _graph->endNode();
+
+	_forward.weights[start] = 0;
+	_forward.queue.insert(start, 0.0f);
+	_backward.weights[end] = 0;
+	_backward.queue.insert(end, 0.0f);
+
+	if (start == end) {
+		_bestWeight = 0;
+		_meetingNode = start;
+	}
+}
+
+int ContractionHierarchyQuery::step() {
+	if (_finished) {
+		return -1;
+	}
+
+	bool forwardFinished = isSideFinished(_forward);
+	bool backwardFinished = isSideFinished(_backward);
+	if (forwardFinished && backwardFinished) {
+		finish();
+		return -1;
+	}
+
+	// alternate sides while both are running
+	bool forward = backwardFinished || (!forwardFinished && _forwardTurn);
+	_forwardTurn = !forward;
+
+	Side& side = forward ? _forward : _backward;
+	const Side& otherSide = forward ? _backward : _forward;
+
+	int node = side.queue.top();
+	side.queue.pop();
+
+	for (const ContractionHierarchy::Edge& edge : _hierarchy->upward(node)) {
+		int weight = side.weights[node] + edge.weight;
+		int target = edge.target;
+
+		if (side.weights[target] < 0) {
+			side.weights[target] = weight;
+			side.queue.insert(target, static_cast<float>(weight));
+		}
+		else if (side.weights[target] > weight) {
+			side.weights[target] = weight;
+			side.queue.decreaseKey(target, static_cast<float>(weight));
+		}
+		else {
+			continue;
+		}
+		side.parents[target] = node;
+
+		// target was reached from the other end too
+		int otherWeight = otherSide.weights[target];
+		if (otherWeight >= 0 && (_bestWeight < 0 || weight + otherWeight < _bestWeight)) {
+			_bestWeight = weight + otherWeight;
+			_meetingNode = target;
+		}
+	}
+
+	return node;
+}
+
+SearchResult ContractionHierarchyQuery::solve() {
+	while (step() != -1) {
+	}
+
+	return makeResult(_graph->startNode(), _graph->endNode(), static_cast<float>(_bestWeight));
+}
+
+bool ContractionHierarchyQuery::isSideFinished(const Side& side)const {
+	return side.queue.isEmpty() || (_bestWeight >= 0 && side.queue.topKey() >= static_cast<float>(_bestWeight));
+}
+
+void ContractionHierarchyQuery::finish() {
+	_finished = true;
+
+	if (_meetingNode < 0) {
+		// no path
+		return;
+	}
+
+	// hierarchy path: start ... meeting node ... end
+	std::vector<int> hierarchyPath;
+	for (int node = _meetingNode; node >= 0; node = _forward.parents[node]) {
+		hierarchyPath.push_back(node);
+	}
+	std::reverse(hierarchyPath.begin(), hierarchyPath.end());
+	for (int node = _backward.parents[_meetingNode]; node >= 0; node = _backward.parents[node]) {
+		hierarchyPath.push_back(node);
+	}
+
+	// replace the shortcuts by the nodes they skip
+	std::vector<int> path(1, hierarchyPath.front());
+	for (size_t i = 1; i < hierarchyPath.size(); ++i) {
+		_hierarchy->unpack(hierarchyPath[i - 1], hierarchyPath[i], path);
+	}
+
+	for (size_t i = 1; i < path.size(); ++i) {
+		_parents[path[i]] = path[i - 1];
+	}
+}
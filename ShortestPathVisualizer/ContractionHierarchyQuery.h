@@ -0,0 +1,54 @@
+#pragma once
+
+#include "IShortestPathStrategy.h"
+
+#include "ContractionHierarchy.h"
+#include "DaryHeap.h"
+#include "IGraph.h"
+
+#include <memory>
+#include <vector>
+
+// Point to point query on a ContractionHierarchy: a Dijkstra from the start and one from the end,
+// both only going up the hierarchy. step() alternates sides like BidirectionalSearch. A side stops
+// when its smallest key reaches the best path found (the sum rule of plain bidirectional Dijkstra
+// does not hold, both searches go up). When the search ends the shortcuts of the path are unpacked,
+// so parents() holds the real start -> end path of the graph for drawPath.
+class ContractionHierarchyQuery :
+	public IShortestPathStrategy
+{
+public:
+	// hierarchy must have been built for graph (only its start and end nodes are read)
+	ContractionHierarchyQuery(std::shared_ptr<const IGraph> graph, std::shared_ptr<const ContractionHierarchy> hierarchy, size_t capacity);
+	virtual ~ContractionHierarchyQuery() = default;
+
+	int step() override final;
+	SearchResult solve() override final;
+
+	// length of the shortest path (negative while none is known)
+	int pathWeight()const { return _bestWeight; }
+private:
+	struct Side {
+		Side(size_t capacity) :
+			queue(capacity),
+			weights(capacity, -1),
+			parents(capacity, -1) {
+		}
+
+		DaryHeap<4> queue;
+		std::vector<int> weights;	// less than zero like infinite
+		std::vector<int> parents;	// in the hierarchy, an edge can be a shortcut
+	};
+
+	bool isSideFinished(const Side& side)const;
+	void finish();
+
+	std::shared_ptr<const IGraph> _graph;
+	std::shared_ptr<const ContractionHierarchy> _hierarchy;
+	Side _forward;
+	Side _backward;
+	bool _forwardTurn;
+	bool _finished;
+	int _bestWeight;
+	int _meetingNode;
+};
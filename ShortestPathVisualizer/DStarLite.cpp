@@ -0,0 +1,190 @@
+#include "DStarLite.h"
+
+#include "DaryHeap.h"
+#include "GridGraph.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace {
+	// large enough to mean no path, small enough that adding a heuristic doesn't overflow
+	const int infinite = std::numeric_limits<int>::max() / 4;
+}
+
+DStarLite::DStarLite(std::shared_ptr<const GridGraph> graph, size_t capacity) :
+	IShortestPathStrategy(capacity),
+	_graph(graph),
+	_queue(capacity),
+	_g(capacity, infinite),
+	_rhs(capacity, infinite),
+	_start(graph->startNode()),
+	_lastStart(graph->startNode()),
+	_end(graph->endNode()),
+	_keyModifier(0),
+	_pathKnown(false),
+	_expansions(0) {
+	_rhs[_end] = 0;
+	_queue.insert(_end, calculateKey(_end));
+}
+
+int DStarLite::step() {
+	if (_pathKnown) {
+		return -1;
+	}
+
+	while (!_queue.isEmpty()) {
+		// done when the start is consistent and nothing in the queue can still improve it
+		if (!(_queue.topKey() < calculateKey(_start)) && _rhs[_start] == _g[_start]) {
+			break;
+		}
+
+		int node = _queue.top();
+		Key oldKey = _queue.topKey();
+		Key newKey = calculateKey(node);
+		if (oldKey < newKey) {
+			// the key was computed from an older start
+			_queue.updateKey(node, newKey);
+			continue;
+		}
+
+		++_expansions;
+		_queue.remove(node);
+		if (_g[node] > _rhs[node]) {
+			// overconsistent: its distance went down, it is final now
+			_g[node] = _rhs[node];
+		}
+		else {
+			// underconsistent: its distance went up, it is recomputed from the neighbors
+			_g[node] = infinite;
+			updateVertex(node);
+		}
+
+		for (int neighbor : _graph->neighbors(node, _neighborBuffer)) {
+			updateVertex(neighbor);
+		}
+
+		return node;
+	}
+
+	fillPath();
+	return -1;
+}
+
+SearchResult DStarLite::solve() {
+	while (step() != -1) {
+	}
+
+	return makeResult(_start, _end, static_cast<float>(pathWeight()));
+}
+
+void DStarLite::tileChanged(int x, int y) {
+	// keys in the queue are lower bounds again once the start moved distance is added
+	_keyModifier += heuristicDistance(_lastStart, _start);
+	_lastStart = _start;
+
+	int node = _graph->index(x, y);
+	updateVertex(node);
+
+	// the edges to the tile are the ones that changed (its cost is the cost of entering it),
+	// neighbors() of a blocked tile is empty so they are listed here
+	const int offsets[4][2] = { { 0, -1 }, { 0, 1 }, { -1, 0 }, { 1, 0 } };
+	for (const auto& offset : offsets) {
+		int neighborX = x + offset[0];
+		int neighborY = y + offset[1];
+		if (neighborX >= 0 && neighborX < _graph->width() && neighborY >= 0 && neighborY < _graph->height()) {
+			updateVertex(_graph->index(neighborX, neighborY));
+		}
+	}
+
+	_pathKnown = false;
+}
+
+void DStarLite::moveStart(int node) {
+	_start = node;
+	_pathKnown = false;
+}
+
+int DStarLite::pathWeight()const {
+	return _pathKnown && _g[_start] < infinite ? _g[_start] : -1;
+}
+
+DStarLite::Key DStarLite::calculateKey(int node)const {
+	int weight = std::min(_g[node], _rhs[node]);
+	return Key(weight + heuristicDistance(_start, node) + _keyModifier, weight);
+}
+
+void DStarLite::updateVertex(int node) {
+	if (node != _end) {
+		_rhs[node] = lookahead(node);
+	}
+
+	if (_g[node] != _rhs[node]) {
+		if (_queue.contains(node)) {
+			_queue.updateKey(node, calculateKey(node));
+		}
+		else {
+			_queue.insert(node, calculateKey(node));
+		}
+	}
+	else if (_queue.contains(node)) {
+		_queue.remove(node);
+	}
+}
+
+int DStarLite::lookahead(int node)const {
+	// blocked tiles have no neighbors, so they stay at infinite
+	IGraph::NeighborBuffer buffer;
+	int best = infinite;
+	for (int neighbor : _graph->neighbors(node, buffer)) {
+		best = std::min(best, _g[neighbor] + _graph->cellCost(neighbor));
+	}
+
+	return best;
+}
+
+int DStarLite::heuristicDistance(int from, int to)const {
+	int fromX = 0;
+	int fromY = 0;
+	int toX = 0;
+	int toY = 0;
+	_graph->coordinates(from, fromX, fromY);
+	_graph->coordinates(to, toX, toY);
+
+	return std::abs(fromX - toX) + std::abs(fromY - toY);
+}
+
+void DStarLite::fillPath() {
+	_pathKnown = true;
+
+	for (int node : _path) {
+		_parents[node] = -1;
+	}
+	_path.clear();
+
+	if (_g[_start] >= infinite) {
+		// no path
+		return;
+	}
+
+	// walk down the distances to the end, every tile points back to the one it came from
+	int current = _start;
+	while (current != _end) {
+		int next = -1;
+		int nextWeight = infinite;
+		for (int neighbor : _graph->neighbors(current, _neighborBuffer)) {
+			int weight = _g[neighbor] + _graph->cellCost(neighbor);
+			if (next < 0 || weight < nextWeight) {
+				next = neighbor;
+				nextWeight = weight;
+			}
+		}
+
+		_parents[next] = current;
+		_path.push_back(next);
+		current = next;
+	}
+}
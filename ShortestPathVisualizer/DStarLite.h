@@ -0,0 +1,61 @@
+#pragma once
+
+#include "IShortestPathStrategy.h"
+
+#include "DaryHeap.h"
+#include "GridGraph.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+// D* Lite (Koenig & Likhachev): searches from the end towards the start and keeps its g and rhs values
+// after the search, so when tiles change only the vertices whose distance to the end changed are
+// processed again. The start can also move along the path (an agent walking it) without losing them.
+// A move costs the cost of the tile it enters (GridGraph::cellCost, 1 without terrain). The tiles are read
+// from graph, which the caller changes (GridGraph::setBlocked or setCost) before telling the search with tileChanged().
+// step() processes one vertex and returns it; when the path is known parents() holds it (start -> end)
+// and step() returns -1 until the next change.
+class DStarLite :
+	public IShortestPathStrategy
+{
+public:
+	DStarLite(std::shared_ptr<const GridGraph> graph, size_t capacity);
+	virtual ~DStarLite() = default;
+
+	int step() override final;
+	SearchResult solve() override final;
+
+	// tile (x, y) was blocked, cleared or got another cost in graph, the next steps repair the search
+	void tileChanged(int x, int y);
+	// the search continues from node (the end does not change)
+	void moveStart(int node);
+
+	int startNode()const { return _start; }
+	// length of the path from the start to the end (negative if there is none or it is not known yet)
+	int pathWeight()const;
+	// vertices processed since the search was created
+	int expansions()const { return _expansions; }
+private:
+	typedef std::pair<int, int> Key;
+
+	Key calculateKey(int node)const;
+	void updateVertex(int node);
+	// smallest cost of a neighbor plus the cost of entering it
+	int lookahead(int node)const;
+	int heuristicDistance(int from, int to)const;
+	void fillPath();
+
+	std::shared_ptr<const GridGraph> _graph;
+	DaryHeap<4, Key> _queue;
+	std::vector<int> _g;
+	std::vector<int> _rhs;
+	int _start;
+	int _lastStart;
+	int _end;
+	int _keyModifier;
+	bool _pathKnown;
+	std::vector<int> _path;		// tiles whose parents are set, cleared before the next path is written
+	int _expansions;
+	IGraph::NeighborBuffer _neighborBuffer;
+};
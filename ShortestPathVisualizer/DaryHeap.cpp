@@ -0,0 +1,149 @@
+#include "DaryHeap.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+template<int Arity, class Key>
+DaryHeap<Arity, Key>::DaryHeap(size_t capacity) :
+	_positions(capacity, -1) {
+	_keys.reserve(capacity);
+	_nodes.reserve(capacity);
+}
+
+template<int Arity, class Key>
+void DaryHeap<Arity, Key>::insert(int node, Key key) {
+	assert(!contains(node));
+
+	_keys.push_back(key);
+	_nodes.push_back(node);
+	siftUp(static_cast<int>(_keys.size()) - 1, key, node);
+}
+
+template<int Arity, class Key>
+void DaryHeap<Arity, Key>::decreaseKey(int node, Key key) {
+	assert(contains(node));
+	assert(key <= _keys[_positions[node]]);
+
+	siftUp(_positions[node], key, node);
+}
+
+template<int Arity, class Key>
+void DaryHeap<Arity, Key>::updateKey(int node, Key key) {
+	assert(contains(node));
+
+	int index = _positions[node];
+	if (key < _keys[index]) {
+		siftUp(index, key, node);
+	}
+	else {
+		siftDown(index, key, node);
+	}
+}
+
+template<int Arity, class Key>
+void DaryHeap<Arity, Key>::remove(int node) {
+	assert(contains(node));
+
+	int index = _positions[node];
+	_positions[node] = -1;
+
+	Key lastKey = _keys.back();
+	int lastNode = _nodes.back();
+	_keys.pop_back();
+	_nodes.pop_back();
+
+	if (index < static_cast<int>(_keys.size())) {
+		// the last element fills the hole, it can belong above or below it
+		if (index > 0 && lastKey < _keys[parent(index)]) {
+			siftUp(index, lastKey, lastNode);
+		}
+		else {
+			siftDown(index, lastKey, lastNode);
+		}
+	}
+}
+
+template<int Arity, class Key>
+void DaryHeap<Arity, Key>::pop() {
+	assert(!isEmpty());
+
+	_positions[_nodes[0]] = -1;
+
+	Key lastKey = _keys.back();
+	int lastNode = _nodes.back();
+	_keys.pop_back();
+	_nodes.pop_back();
+
+	if (!_keys.empty()) {
+		// the last element goes to the root hole and sinks from there
+		siftDown(0, lastKey, lastNode);
+	}
+}
+
+template<int Arity, class Key>
+void DaryHeap<Arity, Key>::clear() {
+	// only the nodes still in the heap have a position
+	for (int node : _nodes) {
+		_positions[node] = -1;
+	}
+
+	_keys.clear();
+	_nodes.clear();
+}
+
+template<int Arity, class Key>
+void DaryHeap<Arity, Key>::siftUp(int index, Key key, int node) {
+	// move the hole up instead of swapping, the element is written once at the end
+	while (index != 0) {
+		int p = parent(index);
+		if (_keys[p] <= key) {
+			break;
+		}
+
+		place(index, _keys[p], _nodes[p]);
+		index = p;
+	}
+
+	place(index, key, node);
+}
+
+template<int Arity, class Key>
+void DaryHeap<Arity, Key>::siftDown(int index, Key key, int node) {
+	const int count = static_cast<int>(_keys.size());
+
+	while (true) {
+		int first = firstChild(index);
+		if (first >= count) {
+			break;
+		}
+
+		// smallest child, children of a node are contiguous in the keys array
+		int last = first + Arity < count ? first + Arity : count;
+		int minChild = first;
+		Key minKey = _keys[first];
+		for (int child = first + 1; child < last; ++child) {
+			if (_keys[child] < minKey) {
+				minKey = _keys[child];
+				minChild = child;
+			}
+		}
+
+		if (key <= minKey) {
+			break;
+		}
+
+		place(index, minKey, _nodes[minChild]);
+		index = minChild;
+	}
+
+	place(index, key, node);
+}
+
+template class DaryHeap<2>;
+template class DaryHeap<4>;
+template class DaryHeap<8>;
+template class DaryHeap<4, uint16_t>;
+template class DaryHeap<4, uint32_t>;
+template class DaryHeap<4, std::pair<int, int>>;
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <vector>
+
+// Indexed d-ary min heap over node ids (Arity 2, 4 or 8, instantiated in DaryHeap.cpp).
+// Keys and node ids live in two compact parallel arrays and the position of every node
+// in the heap is kept in the heap itself, so nothing is written into the graph.
+// Same node based interface as the other priority queues:
+//	insert(node, key), decreaseKey(node, key), top(), topKey(), pop()
+// plus updateKey and remove, which incremental searches need (keys can go up there).
+// Key is float for the searches, uint16_t/uint32_t for the searches with integer costs,
+// std::pair<int, int> (compared lexicographically) for DStarLite.
+template<int Arity, class Key = float>
+class DaryHeap
+{
+public:
+	typedef Key KeyType;
+
+	static_assert(Arity == 2 || Arity == 4 || Arity == 8, "DaryHeap arity must be 2, 4 or 8");
+
+	DaryHeap(size_t capacity);
+	~DaryHeap() = default;
+
+	void insert(int node, Key key);
+	void decreaseKey(int node, Key key);
+	// key can be larger or smaller than the current one
+	void updateKey(int node, Key key);
+	void remove(int node);
+
+	int top()const {
+		assert(!isEmpty());
+		return _nodes[0];
+	}
+
+	Key topKey()const {
+		assert(!isEmpty());
+		return _keys[0];
+	}
+
+	void pop();
+	// empties the heap, O(size)
+	void clear();
+
+	bool contains(int node)const { return _positions[node] >= 0; }
+	Key key(int node)const {
+		assert(contains(node));
+		return _keys[_positions[node]];
+	}
+
+	bool isEmpty()const { return _keys.empty(); }
+	size_t size()const { return _keys.size(); }
+	size_t capacity()const { return _positions.size(); }
+private:
+	//precondition index > 0
+	static int parent(int index) {
+		assert(index > 0);
+		return (index - 1) / Arity;
+	}
+
+	static int firstChild(int index) {
+		return index * Arity + 1;
+	}
+
+	void siftUp(int index, Key key, int node);
+	void siftDown(int index, Key key, int node);
+
+	void place(int index, Key key, int node) {
+		_keys[index] = key;
+		_nodes[index] = node;
+		_positions[node] = index;
+	}
+
+	std::vector<Key> _keys;		// _keys[i] is the key of _nodes[i]
+	std::vector<int> _nodes;
+	std::vector<int> _positions;	// position of every node in the heap (-1 when not in it)
+};
@@ -1,34 +1,43 @@
 #pragma once
 
-#include "IShortestPathStrategy.h"
-
-#include "Graph.h"
-#include "MinHeap.h"
-
-#include <memory>
-#include <vector>
-
-class Dijkstra :
-    public IShortestPathStrategy
-{
-public:
-	Dijkstra(std::shared_ptr<Graph> graph, size_t capacity) :
-		IShortestPathStrategy(capacity),
-		_graph(graph),
-		_minHeap(capacity),
-		_weightsFromStart(capacity, -1.0f){
-		initialize();
-	}
-
-	virtual ~Dijkstra() = default;
-
-	int step() override final;
-private:
-	void initialize();
-	void relaxEdge(int u, int v);
-
-	std::shared_ptr<Graph> _graph;
-	MinHeap _minHeap;
-	std::vector<float> _weightsFromStart;
-};
-
+#include "BestFirstSearch.h"
+#include "BucketQueue.h"
+#include "DaryHeap.h"
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "RadixHeap.h"
+#include "SearchPolicies.h"
+
+#include <stdint.h>
+
+// Dijkstra over any IGraph, every edge costs 1 (a BestFirstSearch without heuristic).
+// PriorityQueue can be DaryHeap<2/4/8>, MinHeapQueue, BucketQueue or RadixHeap.
+// BucketQueue and RadixHeap need integer costs, which is the case for unit edge weights.
+template<class PriorityQueue = DaryHeap<4>>
+using Dijkstra = BestFirstSearch<IGraph, float, PriorityQueue, ZeroHeuristic, UnitEdges>;
+
+// the same search on a GridGraph known at compile time, like GridAStar
+template<class PriorityQueue = DaryHeap<4>>
+using GridDijkstra = BestFirstSearch<GridGraph, float, PriorityQueue, ZeroHeuristic, UnitEdges>;
+
+// the same search with integer distances, uint32_t or uint16_t (paths shorter than 65535 steps).
+// The keys reach BucketQueue, RadixHeap or DaryHeap<4, uint32_t> without a float conversion
+// and a SearchContext<PriorityQueue, uint16_t> has smaller slots
+template<class PriorityQueue = BucketQueue, class Cost = uint32_t>
+using IntegerDijkstra = BestFirstSearch<IGraph, Cost, PriorityQueue, ZeroHeuristic, UnitEdges>;
+
+template<class PriorityQueue = BucketQueue, class Cost = uint32_t>
+using IntegerGridDijkstra = BestFirstSearch<GridGraph, Cost, PriorityQueue, ZeroHeuristic, UnitEdges>;
+
+// Dijkstra over the edge weights of the graph (terrain costs of a GridGraph).
+// Terrain costs are small integers with a wider spread than BucketQueue's window, so RadixHeap is the default
+template<class PriorityQueue = RadixHeap, class Cost = uint32_t>
+using WeightedDijkstra = BestFirstSearch<IGraph, Cost, PriorityQueue, ZeroHeuristic, WeightedEdges>;
+
+template<class PriorityQueue = RadixHeap, class Cost = uint32_t>
+using WeightedGridDijkstra = BestFirstSearch<GridGraph, Cost, PriorityQueue, ZeroHeuristic, WeightedEdges>;
+
+// Dijkstra on an 8-connected GridGraph: diagonal moves cost sqrt(2) (times the terrain cost of the cell entered),
+// Cutting says when they may pass next to blocked cells. Costs are float, so the queue is a heap
+template<class PriorityQueue = DaryHeap<4>, CornerCutting Cutting = CornerCutting::Never>
+using OctileDijkstra = BestFirstSearch<GridGraph, float, PriorityQueue, ZeroHeuristic, EightConnectedEdges<Cutting>>;
@@ -1,6 +1,7 @@
 #include "Graph.h"
 
 #include <list>
+#include <utility>
 #include <vector>
 
 bool operator==(const Graph::Node& left, const Graph::Node& right) {
@@ -8,9 +9,20 @@ bool operator==(const Graph::Node& left, const Graph::Node& right) {
 	// ignore the heapIndex member
 }
 
-Graph::Graph(int numberOfNodes):
-	_startNode(0),
-	_endNode(0) {
-	_nodes.reserve(numberOfNodes);
-	_adjacencyList.reserve(numberOfNodes);
-}
\ No newline at end of file
+Graph::Graph(std::vector<Node> nodes, const std::vector<std::list<int>>& adjacencyList, int startNode, int endNode) :
+	_nodes(std::move(nodes)),
+	_startNode(startNode),
+	_endNode(endNode) {
+	// first pass: offsets (prefix sum of the degrees) so the neighbors array is allocated once
+	_offsets.reserve(adjacencyList.size() + 1);
+	_offsets.push_back(0);
+	for (const auto& adjacents : adjacencyList) {
+		_offsets.push_back(_offsets.back() + static_cast<int>(adjacents.size()));
+	}
+
+	// second pass: copy every list contiguously
+	_neighbors.reserve(_offsets.back());
+	for (const auto& adjacents : adjacencyList) {
+		_neighbors.insert(_neighbors.end(), adjacents.begin(), adjacents.end());
+	}
+}
@@ -1,9 +1,13 @@
 #pragma once
 
+#include "IGraph.h"
+
 #include <list>
+#include <stddef.h>
 #include <vector>
 
-class Graph
+class Graph :
+	public IGraph
 {
 public:
 	struct Node {
@@ -13,24 +17,46 @@ public:
 		int heapIndex;
 	};
 
-	Graph(int numberOfNodes);
-	~Graph() = default;
+	// the adjacency list is only used as construction input (see GraphBuilder),
+	// it is flattened into a compressed sparse row (CSR) representation:
+	// neighbors of node i are _neighbors[_offsets[i]] ... _neighbors[_offsets[i+1]-1]
+	Graph(std::vector<Node> nodes, const std::vector<std::list<int>>& adjacencyList, int startNode, int endNode);
+	virtual ~Graph() = default;
 
 	const std::vector<Node>& nodes() const { return _nodes; }
 	std::vector<Node>& nodes() { return _nodes; }
 
-	const std::vector<std::list<int>>& adjacencyList() const { return _adjacencyList; }
-	std::vector<std::list<int>>& adjacencyList() { return _adjacencyList; }
+	int numberOfNodes() const override final { return static_cast<int>(_nodes.size()); }
+
+	NeighborRange neighbors(int node) const {
+		const int* first = _neighbors.data();
+		return NeighborRange(first + _offsets[node], first + _offsets[node + 1]);
+	}
+
+	NeighborRange neighbors(int node, NeighborBuffer&) const override final { return neighbors(node); }
+
+	void coordinates(int node, int& x, int& y) const override final {
+		x = _nodes[node].x;
+		y = _nodes[node].y;
+	}
+
+	size_t numberOfEdges() const { return _neighbors.size(); }
+
+	// edges are unweighted (every edge counts 1)
+	bool hasUniformEdgeWeights() const override final { return true; }
+	int edgeWeight(int, int) const override final { return 1; }
+	int minimumEdgeWeight() const override final { return 1; }
 
-	int startNode() const { return _startNode; }
+	int startNode() const override final { return _startNode; }
 	int& startNode() { return _startNode; }
 
-	int endNode() const { return _endNode; }
+	int endNode() const override final { return _endNode; }
 	int& endNode() { return _endNode; }
 
 private:
 	std::vector<Node> _nodes;
-	std::vector<std::list<int>> _adjacencyList;
+	std::vector<int> _offsets;
+	std::vector<int> _neighbors;
 	int _startNode;
 	int _endNode;
 };
@@ -0,0 +1,18 @@
+#include "GraphBuilder.h"
+
+#include "Graph.h"
+
+#include <list>
+#include <memory>
+#include <vector>
+
+GraphBuilder::GraphBuilder(int numberOfNodes) :
+	_startNode(0),
+	_endNode(0) {
+	_nodes.reserve(numberOfNodes);
+	_adjacencyList.reserve(numberOfNodes);
+}
+
+std::shared_ptr<Graph> GraphBuilder::build() const {
+	return std::make_shared<Graph>(_nodes, _adjacencyList, _startNode, _endNode);
+}
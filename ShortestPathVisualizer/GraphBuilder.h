@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Graph.h"
+
+#include <list>
+#include <memory>
+#include <vector>
+
+// Collects nodes and adjacency lists while the graph is being discovered
+// and builds the (immutable, CSR backed) Graph once everything was added.
+class GraphBuilder
+{
+public:
+	GraphBuilder(int numberOfNodes);
+	~GraphBuilder() = default;
+
+	const std::vector<Graph::Node>& nodes() const { return _nodes; }
+	std::vector<Graph::Node>& nodes() { return _nodes; }
+
+	const std::vector<std::list<int>>& adjacencyList() const { return _adjacencyList; }
+	std::vector<std::list<int>>& adjacencyList() { return _adjacencyList; }
+
+	int startNode() const { return _startNode; }
+	int& startNode() { return _startNode; }
+
+	int endNode() const { return _endNode; }
+	int& endNode() { return _endNode; }
+
+	std::shared_ptr<Graph> build() const;
+
+private:
+	std::vector<Graph::Node> _nodes;
+	std::vector<std::list<int>> _adjacencyList;
+	int _startNode;
+	int _endNode;
+};
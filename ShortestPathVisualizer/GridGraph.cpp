@@ -0,0 +1,90 @@
+#include "GridGraph.h"
+
+#include "IGraph.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+constexpr int GridGraph::directionOffsets[8][2];
+constexpr float GridGraph::diagonalCost;
+
+GridGraph::GridGraph(int width, int height) :
+	_width(width),
+	_height(height),
+	_wordsPerRow((width + 63) >> 6),
+	_blocked(static_cast<size_t>((width + 63) >> 6) * height, 0),
+	_version(0),
+	_startNode(0),
+	_endNode(0) {
+}
+
+void GridGraph::setBlocked(int x, int y, bool blocked) {
+	uint64_t& word = _blocked[y * _wordsPerRow + (x >> 6)];
+	uint64_t mask = uint64_t(1) << (x & 63);
+	uint64_t changed = blocked ? word | mask : word & ~mask;
+	if (changed != word) {
+		word = changed;
+		++_version;
+	}
+}
+
+void GridGraph::setCost(int x, int y, int cost) {
+	assert(cost >= 1 && cost <= 255);
+	if (cost == this->cost(x, y)) {
+		return;
+	}
+
+	if (_costs.empty()) {
+		// first weighted cell, every other one still costs 1
+		_costs.assign(numberOfNodes(), 1);
+		_cellsWithCost.assign(256, 0);
+		_cellsWithCost[1] = numberOfNodes();
+	}
+
+	uint8_t& cellCost = _costs[index(x, y)];
+	--_cellsWithCost[cellCost];
+	cellCost = static_cast<uint8_t>(cost);
+	++_cellsWithCost[cellCost];
+	++_version;
+}
+
+int GridGraph::minimumEdgeWeight() const {
+	if (_costs.empty()) {
+		return 1;
+	}
+
+	int cost = 1;
+	while (_cellsWithCost[cost] == 0) {
+		++cost;
+	}
+
+	return cost;
+}
+
+IGraph::NeighborRange GridGraph::neighbors(int node, NeighborBuffer& buffer) const {
+	int x = 0;
+	int y = 0;
+	coordinates(node, x, y);
+
+	int count = 0;
+	//blocked cells have no adjacency
+	if (!isBlocked(x, y)) {
+		//same order as the adjacency lists used to be built: top, bottom, left, right
+		if (y > 0 && !isBlocked(x, y - 1)) {
+			buffer[count++] = node - _width;
+		}
+		if (y + 1 < _height && !isBlocked(x, y + 1)) {
+			buffer[count++] = node + _width;
+		}
+		if (x > 0 && !isBlocked(x - 1, y)) {
+			buffer[count++] = node - 1;
+		}
+		if (x + 1 < _width && !isBlocked(x + 1, y)) {
+			buffer[count++] = node + 1;
+		}
+	}
+
+	return NeighborRange(buffer.data(), buffer.data() + count);
+}
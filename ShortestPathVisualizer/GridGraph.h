@@ -0,0 +1,125 @@
+#pragma once
+
+#include "IGraph.h"
+
+#include <stdint.h>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// movement rules of the searches that walk the cells themselves instead of neighbors() (jump point search)
+enum class GridMovement
+{
+	FourConnected,	// up, down, left and right, every move costs 1
+	EightConnected	// also diagonals (cost sqrt(2)), never cutting the corner of a blocked cell
+};
+
+// when a diagonal move may pass next to blocked cells (the two cells it goes between)
+enum class CornerCutting
+{
+	Never,		// both cells must be free (the rule of GridMovement::EightConnected)
+	OneCorner,	// one of them can be blocked
+	Always		// only the cell moved to must be free
+};
+
+// 4-connected grid graph whose edges are never stored: the neighbors of a cell are
+// computed on the fly from a packed obstacle bitmap (one bit per cell, rows padded to 64 bits).
+// Node index of cell (x, y) is x + y * width, the same indexing used by the visualizer grid.
+// The graph can be kept between searches: blocking or clearing a cell only changes its bit (the edges
+// of its neighbors follow from it), and version() changes with every such edit so data computed from
+// the obstacles knows when it is stale.
+// Cells can also have a terrain cost (1 to 255, entering the cell costs it): one byte per cell, only
+// allocated once a cell costs more than 1. Until then the grid is unweighted and every move costs 1.
+class GridGraph :
+	public IGraph
+{
+public:
+	// up, down, left, right (the order of neighbors()), then up left, up right, down left and down right
+	static constexpr int directionOffsets[8][2] = {
+		{ 0, -1 }, { 0, 1 }, { -1, 0 }, { 1, 0 },
+		{ -1, -1 }, { 1, -1 }, { -1, 1 }, { 1, 1 }
+	};
+	static constexpr float diagonalCost = 1.41421356f;
+
+	GridGraph(int width, int height);
+	virtual ~GridGraph() = default;
+
+	int width() const { return _width; }
+	int height() const { return _height; }
+
+	int index(int x, int y) const { return x + y * _width; }
+
+	bool isBlocked(int x, int y) const {
+		return ((_blocked[y * _wordsPerRow + (x >> 6)] >> (x & 63)) & 1) != 0;
+	}
+
+	// O(1), the version only changes if the cell did
+	void setBlocked(int x, int y, bool blocked);
+
+	// cost of entering cell (x, y), 1 unless setCost changed it
+	int cost(int x, int y) const { return cellCost(index(x, y)); }
+	int cellCost(int node) const { return _costs.empty() ? 1 : _costs[node]; }
+
+	// cost in [1, 255], O(1), the version only changes if the cost did
+	void setCost(int x, int y, int cost);
+
+	// number of cells blocked, cleared or given another cost since the graph was created
+	uint64_t version() const { return _version; }
+
+	int wordsPerRow() const { return _wordsPerRow; }
+	const std::vector<uint64_t>& blockedBits() const { return _blocked; }
+
+	// index of the lowest and highest set bit of a word of blockedBits() (word can't be 0)
+	static int lowestBit(uint64_t word) {
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		_BitScanForward64(&index, word);
+		return static_cast<int>(index);
+#else
+		return __builtin_ctzll(word);
+#endif
+	}
+
+	static int highestBit(uint64_t word) {
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		_BitScanReverse64(&index, word);
+		return static_cast<int>(index);
+#else
+		return 63 - __builtin_clzll(word);
+#endif
+	}
+
+	int numberOfNodes() const override final { return _width * _height; }
+
+	NeighborRange neighbors(int node, NeighborBuffer& buffer) const override final;
+
+	void coordinates(int node, int& x, int& y) const override final {
+		x = node % _width;
+		y = node / _width;
+	}
+
+	// every move to an adjacent cell costs 1 until a cell gets a terrain cost
+	bool hasUniformEdgeWeights() const override final { return _costs.empty() || _cellsWithCost[1] == numberOfNodes(); }
+	int edgeWeight(int, int to) const override final { return cellCost(to); }
+	int minimumEdgeWeight() const override final;
+
+	int startNode() const override final { return _startNode; }
+	int& startNode() { return _startNode; }
+
+	int endNode() const override final { return _endNode; }
+	int& endNode() { return _endNode; }
+
+private:
+	int _width;
+	int _height;
+	int _wordsPerRow;
+	std::vector<uint64_t> _blocked;
+	std::vector<uint8_t> _costs;		// cost of every cell, empty while they all cost 1
+	std::vector<int> _cellsWithCost;	// number of cells of every cost (256 counters) once _costs is allocated
+	uint64_t _version;
+	int _startNode;
+	int _endNode;
+};
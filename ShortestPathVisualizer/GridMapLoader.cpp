@@ -0,0 +1,182 @@
+#include "GridMapLoader.h"
+
+#include "GridGraph.h"
+#include "QueryRunner.h"
+#include "ScenarioRunner.h"
+
+#include <istream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+	// reads the next line that is not empty nor a comment, without the '\r' of Windows line endings
+	bool nextLine(std::istream& input, std::string& line, int& lineNumber) {
+		while (std::getline(input, line)) {
+			++lineNumber;
+			if (!line.empty() && line.back() == '\r') {
+				line.pop_back();
+			}
+			if (!line.empty() && line[0] != ';') {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool isFreeCell(const GridGraph& graph, int x, int y) {
+		return x >= 0 && x < graph.width() && y >= 0 && y < graph.height() && !graph.isBlocked(x, y);
+	}
+
+	std::string lineError(int lineNumber, const std::string& message) {
+		return "line " + std::to_string(lineNumber) + ": " + message;
+	}
+
+	// the rest of a MovingAI map once its "type" line was read
+	std::shared_ptr<GridGraph> loadMovingAIMap(std::istream& input, int& lineNumber, std::string& error) {
+		int width = 0;
+		int height = 0;
+		std::string line;
+		while (nextLine(input, line, lineNumber) && line != "map") {
+			std::istringstream fields(line);
+			std::string key;
+			fields >> key;
+			int& value = key == "width" ? width : height;
+			if ((key != "width" && key != "height") || !(fields >> value) || value <= 0) {
+				error = lineError(lineNumber, "expected \"height h\", \"width w\" or \"map\"");
+				return nullptr;
+			}
+		}
+		if (line != "map" || width <= 0 || height <= 0) {
+			error = "the map has no \"height\", \"width\" or \"map\" line";
+			return nullptr;
+		}
+
+		auto graph = std::make_shared<GridGraph>(width, height);
+		for (int y = 0; y < height; ++y) {
+			if (!std::getline(input, line)) {
+				error = "the map has " + std::to_string(y) + " rows, its header says " + std::to_string(height);
+				return nullptr;
+			}
+			++lineNumber;
+			if (!line.empty() && line.back() == '\r') {
+				line.pop_back();
+			}
+			if (line.size() != static_cast<size_t>(width)) {
+				error = lineError(lineNumber, "the row has " + std::to_string(line.size()) + " cells, the header says " + std::to_string(width));
+				return nullptr;
+			}
+
+			for (int x = 0; x < width; ++x) {
+				char cell = line[x];
+				if (cell == '@' || cell == 'O' || cell == 'T' || cell == 'W') {
+					graph->setBlocked(x, y, true);
+				}
+				else if (cell != '.' && cell != 'G' && cell != 'S') {
+					error = lineError(lineNumber, std::string("unknown cell '") + cell + "'");
+					return nullptr;
+				}
+			}
+		}
+
+		return graph;
+	}
+}
+
+std::shared_ptr<GridGraph> GridMapLoader::loadMap(std::istream& input, std::string& error) {
+	std::vector<std::string> rows;
+	std::string line;
+	int lineNumber = 0;
+	bool more = nextLine(input, line, lineNumber);
+	if (more && line.compare(0, 5, "type ") == 0) {
+		return loadMovingAIMap(input, lineNumber, error);
+	}
+	for (; more; more = nextLine(input, line, lineNumber)) {
+		if (!rows.empty() && line.size() != rows[0].size()) {
+			error = lineError(lineNumber, "the row has " + std::to_string(line.size()) + " cells, the first one has " + std::to_string(rows[0].size()));
+			return nullptr;
+		}
+		for (char cell : line) {
+			if (cell != '.' && cell != '#' && (cell < '2' || cell > '9')) {
+				error = lineError(lineNumber, std::string("unknown cell '") + cell + "'");
+				return nullptr;
+			}
+		}
+		rows.push_back(line);
+	}
+
+	if (rows.empty()) {
+		error = "the map has no rows";
+		return nullptr;
+	}
+
+	auto graph = std::make_shared<GridGraph>(static_cast<int>(rows[0].size()), static_cast<int>(rows.size()));
+	for (int y = 0; y < graph->height(); ++y) {
+		for (int x = 0; x < graph->width(); ++x) {
+			char cell = rows[y][x];
+			if (cell == '#') {
+				graph->setBlocked(x, y, true);
+			}
+			else if (cell != '.') {
+				graph->setCost(x, y, cell - '0');
+			}
+		}
+	}
+
+	return graph;
+}
+
+bool GridMapLoader::loadQueries(std::istream& input, const GridGraph& graph, std::vector<GridQuery>& queries, std::string& error) {
+	std::string line;
+	int lineNumber = 0;
+	while (nextLine(input, line, lineNumber)) {
+		std::istringstream fields(line);
+		GridQuery query;
+		std::string rest;
+		if (!(fields >> query.startX >> query.startY >> query.endX >> query.endY) || (fields >> rest)) {
+			error = lineError(lineNumber, "expected \"startX startY endX endY\"");
+			return false;
+		}
+		if (!isFreeCell(graph, query.startX, query.startY) || !isFreeCell(graph, query.endX, query.endY)) {
+			error = lineError(lineNumber, "the start and the end must be free cells of the map");
+			return false;
+		}
+		queries.push_back(query);
+	}
+
+	return true;
+}
+
+bool GridMapLoader::loadScenarios(std::istream& input, const GridGraph& graph, std::vector<Scenario>& scenarios, std::string& error) {
+	std::string line;
+	int lineNumber = 0;
+	if (!nextLine(input, line, lineNumber) || line.compare(0, 8, "version ") != 0) {
+		error = lineError(lineNumber, "expected \"version 1\"");
+		return false;
+	}
+
+	while (nextLine(input, line, lineNumber)) {
+		std::istringstream fields(line);
+		Scenario scenario;
+		std::string rest;
+		if (!(fields >> scenario.bucket >> scenario.map >> scenario.mapWidth >> scenario.mapHeight >> scenario.query.startX >> scenario.query.startY >>
+			scenario.query.endX >> scenario.query.endY >> scenario.optimalLength) || (fields >> rest)) {
+			error = lineError(lineNumber, "expected \"bucket map mapWidth mapHeight startX startY endX endY optimalLength\"");
+			return false;
+		}
+		if (scenario.mapWidth != graph.width() || scenario.mapHeight != graph.height()) {
+			error = lineError(lineNumber, "the scenario is for a map of " + std::to_string(scenario.mapWidth) + "x" + std::to_string(scenario.mapHeight) +
+				", the map is " + std::to_string(graph.width()) + "x" + std::to_string(graph.height()));
+			return false;
+		}
+		if (!isFreeCell(graph, scenario.query.startX, scenario.query.startY) || !isFreeCell(graph, scenario.query.endX, scenario.query.endY)) {
+			error = lineError(lineNumber, "the start and the end must be free cells of the map");
+			return false;
+		}
+		scenarios.push_back(scenario);
+	}
+
+	return true;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "GridGraph.h"
+#include "QueryRunner.h"
+#include "ScenarioRunner.h"
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Reads grids and queries from text, so searches can run without the visualizer.
+//	- a map is one line per row of the grid, all of the same length, one character per cell:
+//	  '.' is a free cell, '#' a blocked one and '2' to '9' a free cell with that terrain cost
+//	- a MovingAI .map ("type octile", "height h", "width w", "map", then the rows) is read too:
+//	  '.', 'G' and 'S' are free cells, '@', 'O', 'T' and 'W' blocked ones (water can't be walked from land)
+//	- queries are one per line, "startX startY endX endY", on free cells of the map
+//	- a MovingAI .scen is "version 1" then one scenario per line:
+//	  "bucket map mapWidth mapHeight startX startY endX endY optimalLength"
+// Empty lines and lines starting with ';' are skipped in all but the rows of a MovingAI map.
+// On a malformed input nothing is returned and error says which line is wrong.
+class GridMapLoader
+{
+public:
+	static std::shared_ptr<GridGraph> loadMap(std::istream& input, std::string& error);
+	static bool loadQueries(std::istream& input, const GridGraph& graph, std::vector<GridQuery>& queries, std::string& error);
+	// the scenarios must be made for a map of the size of graph
+	static bool loadScenarios(std::istream& input, const GridGraph& graph, std::vector<Scenario>& scenarios, std::string& error);
+};
@@ -0,0 +1,230 @@
+#include "HierarchicalAStar.h"
+
+#include "AStar.h"
+#include "BucketQueue.h"
+#include "ClusterAbstraction.h"
+#include "DaryHeap.h"
+#include "GridGraph.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+HierarchicalAStar::HierarchicalAStar(std::shared_ptr<const GridGraph> graph, std::shared_ptr<const ClusterAbstraction> clusters, size_t capacity) :
+	IShortestPathStrategy(capacity),
+	_graph(graph),
+	_clusters(clusters),
+	_queue(clusters->numberOfNodes() + 2),
+	_weights(clusters->numberOfNodes() + 2, -1),
+	_abstractParents(clusters->numberOfNodes() + 2, -1),
+	_startNode(clusters->numberOfNodes()),
+	_endNode(clusters->numberOfNodes() + 1),
+	_searching(true),
+	_abstractExpansions(0),
+	_refinedSteps(1),
+	_pathIndex(capacity, -1),
+	_pathWeight(-1) {
+	int startX = 0;
+	int startY = 0;
+	_graph->coordinates(_graph->startNode(), startX, startY);
+	_graph->coordinates(_graph->endNode(), _endX, _endY);
+	_startCluster = _clusters->cluster(startX, startY);
+	_endCluster = _clusters->cluster(_endX, _endY);
+
+	// the start and the end only connect to the entrances of their clusters, and to each other when they share it
+	_clusters->distancesInCluster(_graph->startNode(), _startDistances);
+	_clusters->distancesInCluster(_graph->endNode(), _endDistances);
+
+	_weights[_startNode] = 0;
+	_queue.insert(_startNode, static_cast<float>(std::abs(startX - _endX) + std::abs(startY - _endY)));
+}
+
+int HierarchicalAStar::step() {
+	return _searching ? abstractStep() : refineStep();
+}
+
+SearchResult HierarchicalAStar::solve() {
+	while (step() != -1) {
+	}
+
+	return makeResult(_graph->startNode(), _graph->endNode(), static_cast<float>(_pathWeight));
+}
+
+int HierarchicalAStar::abstractStep() {
+	if (_queue.isEmpty()) {
+		// no path
+		_searching = false;
+		_refinedSteps = _abstractPath.size();
+		return -1;
+	}
+
+	int node = _queue.top();
+	_queue.pop();
+	++_abstractExpansions;
+
+	if (node == _endNode) {
+		for (int current = node; current >= 0; current = _abstractParents[current]) {
+			_abstractPath.push_back(cell(current));
+		}
+		std::reverse(_abstractPath.begin(), _abstractPath.end());
+
+		_searching = false;
+		appendToPath(_abstractPath.front());
+		return cell(node);
+	}
+
+	if (node == _startNode) {
+		for (int entrance : _clusters->nodes(_startCluster)) {
+			relaxEdge(node, entrance, _startDistances[localIndex(_clusters->cell(entrance))]);
+		}
+		if (_startCluster == _endCluster) {
+			relaxEdge(node, _endNode, _startDistances[localIndex(_graph->endNode())]);
+		}
+	}
+	else {
+		for (const ClusterAbstraction::Edge& edge : _clusters->edges(node)) {
+			relaxEdge(node, edge.target, edge.weight);
+		}
+		if (_clusters->clusterOfNode(node) == _endCluster) {
+			relaxEdge(node, _endNode, _endDistances[localIndex(_clusters->cell(node))]);
+		}
+	}
+
+	return cell(node);
+}
+
+int HierarchicalAStar::refineStep() {
+	if (_refinedSteps >= _abstractPath.size()) {
+		return -1;
+	}
+
+	int from = _abstractPath[_refinedSteps - 1];
+	int to = _abstractPath[_refinedSteps];
+	++_refinedSteps;
+
+	int fromX = 0;
+	int fromY = 0;
+	int toX = 0;
+	int toY = 0;
+	_graph->coordinates(from, fromX, fromY);
+	_graph->coordinates(to, toX, toY);
+	if (_clusters->cluster(fromX, fromY) != _clusters->cluster(toX, toY)) {
+		// entrances of adjacent clusters are adjacent tiles
+		appendToPath(to);
+	}
+	else if (from != to) {
+		refineInCluster(from, to);
+	}
+
+	if (_refinedSteps == _abstractPath.size()) {
+		for (size_t i = 1; i < _path.size(); ++i) {
+			_parents[_path[i]] = _path[i - 1];
+		}
+		_pathWeight = static_cast<int>(_path.size()) - 1;
+	}
+
+	return to;
+}
+
+void HierarchicalAStar::relaxEdge(int from, int to, int weight) {
+	if (weight < 0) {
+		// not connected inside the cluster
+		return;
+	}
+
+	int x = 0;
+	int y = 0;
+	_graph->coordinates(cell(to), x, y);
+	int weightFromStart = _weights[from] + weight;
+	float key = static_cast<float>(weightFromStart + std::abs(x - _endX) + std::abs(y - _endY));
+
+	if (_weights[to] < 0) {
+		_queue.insert(to, key);
+	}
+	else if (weightFromStart < _weights[to]) {
+		_queue.decreaseKey(to, key);
+	}
+	else {
+		return;
+	}
+
+	_weights[to] = weightFromStart;
+	_abstractParents[to] = from;
+}
+
+int HierarchicalAStar::cell(int node)const {
+	if (node == _startNode) {
+		return _graph->startNode();
+	}
+	if (node == _endNode) {
+		return _graph->endNode();
+	}
+
+	return _clusters->cell(node);
+}
+
+int HierarchicalAStar::localIndex(int cell)const {
+	int x = 0;
+	int y = 0;
+	_graph->coordinates(cell, x, y);
+	int clusterSize = _clusters->clusterSize();
+
+	return x % clusterSize + (y % clusterSize) * clusterSize;
+}
+
+void HierarchicalAStar::refineInCluster(int from, int to) {
+	int fromX = 0;
+	int fromY = 0;
+	int left = 0;
+	int top = 0;
+	int right = 0;
+	int bottom = 0;
+	_graph->coordinates(from, fromX, fromY);
+	_clusters->clusterBounds(_clusters->cluster(fromX, fromY), left, top, right, bottom);
+
+	// the cluster as a grid of its own, so AStar doesn't leave it and only needs its tiles
+	auto cluster = std::make_shared<GridGraph>(right - left, bottom - top);
+	for (int y = top; y < bottom; ++y) {
+		for (int x = left; x < right; ++x) {
+			cluster->setBlocked(x - left, y - top, _graph->isBlocked(x, y));
+		}
+	}
+
+	int toX = 0;
+	int toY = 0;
+	_graph->coordinates(to, toX, toY);
+	cluster->startNode() = cluster->index(fromX - left, fromY - top);
+	cluster->endNode() = cluster->index(toX - left, toY - top);
+
+	AStar<BucketQueue> search(cluster, cluster->numberOfNodes());
+	while (search.step() != -1) {
+	}
+
+	std::vector<int> tiles;
+	for (int tile = cluster->endNode(); tile != cluster->startNode(); tile = search.parents()[tile]) {
+		int x = 0;
+		int y = 0;
+		cluster->coordinates(tile, x, y);
+		tiles.push_back(_graph->index(x + left, y + top));
+	}
+
+	for (auto tile = tiles.rbegin(); tile != tiles.rend(); ++tile) {
+		appendToPath(*tile);
+	}
+}
+
+void HierarchicalAStar::appendToPath(int cell) {
+	int index = _pathIndex[cell];
+	if (index >= 0) {
+		// the path came back to a tile it already went through, the loop is cut out
+		for (size_t i = index + 1; i < _path.size(); ++i) {
+			_pathIndex[_path[i]] = -1;
+		}
+		_path.resize(index + 1);
+		return;
+	}
+
+	_pathIndex[cell] = static_cast<int>(_path.size());
+	_path.push_back(cell);
+}
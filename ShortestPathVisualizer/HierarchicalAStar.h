@@ -0,0 +1,64 @@
+#pragma once
+
+#include "IShortestPathStrategy.h"
+
+#include "ClusterAbstraction.h"
+#include "DaryHeap.h"
+#include "GridGraph.h"
+
+#include <memory>
+#include <vector>
+
+// HPA*: A* on the entrances of a ClusterAbstraction, with the start and the end linked to the entrances
+// of their own clusters, then every step of the abstract path is refined with AStar inside its cluster
+// (steps between clusters are already adjacent tiles). step() returns the expanded entrances (as grid
+// cells) and then the last tile of every refined step.
+// Paths are near optimal, not optimal: they have to go through the entrances.
+class HierarchicalAStar :
+	public IShortestPathStrategy
+{
+public:
+	// clusters must be up to date with graph (see ClusterAbstraction::update)
+	HierarchicalAStar(std::shared_ptr<const GridGraph> graph, std::shared_ptr<const ClusterAbstraction> clusters, size_t capacity);
+	virtual ~HierarchicalAStar() = default;
+
+	int step() override final;
+	SearchResult solve() override final;
+
+	// length of the refined path (negative until it is refined or if there is none)
+	int pathWeight()const { return _pathWeight; }
+	// nodes of the abstract graph expanded (start and end included)
+	int abstractExpansions()const { return _abstractExpansions; }
+private:
+	int abstractStep();
+	int refineStep();
+	void relaxEdge(int from, int to, int weight);
+	// abstract nodes are the entrances, then the start and the end
+	int cell(int node)const;
+	// index of cell in the distances of ClusterAbstraction::distancesInCluster
+	int localIndex(int cell)const;
+	// appends the tiles after from up to to, both in the same cluster
+	void refineInCluster(int from, int to);
+	void appendToPath(int cell);
+
+	std::shared_ptr<const GridGraph> _graph;
+	std::shared_ptr<const ClusterAbstraction> _clusters;
+	DaryHeap<4> _queue;
+	std::vector<int> _weights;
+	std::vector<int> _abstractParents;
+	int _startNode;
+	int _endNode;
+	int _startCluster;
+	int _endCluster;
+	std::vector<int> _startDistances;
+	std::vector<int> _endDistances;
+	int _endX;
+	int _endY;
+	bool _searching;
+	int _abstractExpansions;
+	std::vector<int> _abstractPath;		// cells, start to end
+	size_t _refinedSteps;
+	std::vector<int> _path;				// refined tiles, start to end
+	std::vector<int> _pathIndex;		// position of a tile in _path, -1 if it isn't in it
+	int _pathWeight;
+};
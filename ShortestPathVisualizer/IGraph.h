@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+
+// Neighbor iteration interface shared by the explicit (CSR) Graph and the implicit GridGraph.
+// Graphs are read only for the algorithms, every piece of search state lives in the strategy.
+class IGraph {
+public:
+	// maximum number of neighbors an implicit graph can generate for a node
+	static const int maxImplicitDegree = 8;
+
+	// scratch storage owned by the caller, implicit graphs write the neighbors
+	// of the node into it while explicit graphs just ignore it
+	typedef std::array<int, maxImplicitDegree> NeighborBuffer;
+
+	// contiguous view of the neighbors of a node
+	class NeighborRange {
+	public:
+		NeighborRange(const int* first, const int* last) :
+			_first(first),
+			_last(last) {
+		}
+
+		const int* begin()const { return _first; }
+		const int* end()const { return _last; }
+
+		int size()const { return static_cast<int>(_last - _first); }
+		bool isEmpty()const { return _first == _last; }
+	private:
+		const int* _first;
+		const int* _last;
+	};
+
+	virtual ~IGraph() = default;
+
+	virtual int numberOfNodes() const = 0;
+
+	virtual NeighborRange neighbors(int node, NeighborBuffer& buffer) const = 0;
+
+	// position of the node in the plane (used by heuristics)
+	virtual void coordinates(int node, int& x, int& y) const = 0;
+
+	// true when every edge has the same weight (the algorithms can then skip the priority queue)
+	virtual bool hasUniformEdgeWeights() const = 0;
+
+	// weight of the edge from a node to one of its neighbors
+	virtual int edgeWeight(int from, int to) const = 0;
+	// no edge weighs less, heuristics are scaled by it so they stay admissible
+	virtual int minimumEdgeWeight() const = 0;
+
+	virtual int startNode() const = 0;
+	virtual int endNode() const = 0;
+protected:
+	IGraph() = default;
+};
@@ -1,12 +1,28 @@
 #pragma once
 
+#include "SearchStatistics.h"
+
+#include <algorithm>
 #include <vector>
 
+// what solve() returns
+struct SearchResult {
+	float distance;			// from the start to the end, negative if the end can't be reached
+	std::vector<int> path;	// start -> end, empty if the end can't be reached
+};
+
 class IShortestPathStrategy {
 public:
 	virtual ~IShortestPathStrategy() = default;
 
+	// expands one node (for animating the search), returns it or -1 when the search is over
 	virtual int step() = 0;
+	// runs the rest of the search at once, without a virtual call per node; parents() ends up the
+	// same as calling step() until it returns -1
+	virtual SearchResult solve() = 0;
+	// what the search did so far: nodes, queue operations and time, all 0 unless built with
+	// SHORTEST_PATH_STATISTICS (see SearchStatistics.h) or when the search doesn't count
+	virtual SearchStatistics statistics()const { return SearchStatistics(); }
 
 	const std::vector<int>& parents()const { return _parents; }
 protected:
@@ -14,5 +30,28 @@ protected:
 		_parents(capacity, -1.0f) {
 	}
 
+	// the path follows parent() back from end, which is not reached when it has no parent
+	template<class Parent>
+	static SearchResult makeResult(int start, int end, float distance, Parent parent) {
+		SearchResult result;
+		result.distance = distance;
+		if (end != start && parent(end) < 0) {
+			result.distance = -1.0f;
+			return result;
+		}
+
+		for (int node = end; node != start; node = parent(node)) {
+			result.path.push_back(node);
+		}
+		result.path.push_back(start);
+		std::reverse(result.path.begin(), result.path.end());
+
+		return result;
+	}
+
+	SearchResult makeResult(int start, int end, float distance)const {
+		return makeResult(start, end, distance, [this](int node) { return _parents[node]; });
+	}
+
 	std::vector<int> _parents;
-};
\ No newline at end of file
+};
@@ -0,0 +1,412 @@
+#include "JumpPointSearch.h"
+
+#include "DaryHeap.h"
+#include "GridGraph.h"
+#include "JumpPointTable.h"
+#include "SearchStatistics.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <memory>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+namespace {
+	int sign(int value) {
+		return (value > 0) - (value < 0);
+	}
+}
+
+JumpPointSearch::JumpPointSearch(std::shared_ptr<const GridGraph> graph, size_t capacity, GridMovement movement) :
+	IShortestPathStrategy(capacity),
+	_graph(graph),
+	_movement(movement),
+	_queue(capacity),
+	_weightsFromStart(capacity, -1.0f) {
+	assert(graph->hasUniformEdgeWeights());
+	initialize();
+}
+
+JumpPointSearch::JumpPointSearch(std::shared_ptr<const GridGraph> graph, std::shared_ptr<const JumpPointTable> table, size_t capacity) :
+	IShortestPathStrategy(capacity),
+	_graph(graph),
+	_table(table),
+	_movement(table->movement()),
+	_queue(capacity),
+	_weightsFromStart(capacity, -1.0f) {
+	assert(table->matches(*graph) && graph->hasUniformEdgeWeights());
+	initialize();
+}
+
+void JumpPointSearch::initialize() {
+	// keep the end node coordinates at hand for the heuristic
+	_graph->coordinates(_graph->endNode(), _endX, _endY);
+
+	int start = _graph->startNode();
+	_weightsFromStart[start] = 0.0f;
+	_queue.insert(start, heuristicDistance(start));
+	_counters.inserted(_queue.size());
+}
+
+int JumpPointSearch::step() {
+	if (_queue.isEmpty()) {
+		//no more nodes
+		return -1;
+	}
+
+	SearchCounters::ExpansionTimer timer(_counters);
+	int minNode = -1;
+	{
+		SearchCounters::QueueTimer queueTimer(_counters);
+		minNode = _queue.top();
+		_queue.pop();
+	}
+	_counters.popped();
+
+	if (minNode == _graph->endNode()) {
+		// emptying the queue, so later calls don't search on
+		_queue.clear();
+		fillPath();
+		return -1;
+	}
+
+	int x = 0;
+	int y = 0;
+	_graph->coordinates(minNode, x, y);
+
+	// direction in which the jump point was reached (none for the start node)
+	int dx = 0;
+	int dy = 0;
+	int parent = _parents[minNode];
+	if (parent >= 0) {
+		int parentX = 0;
+		int parentY = 0;
+		_graph->coordinates(parent, parentX, parentY);
+		dx = sign(x - parentX);
+		dy = sign(y - parentY);
+	}
+
+	// pruned neighbors, jump() rejects the moves that are not possible
+	int directions[8][2];
+	int count = 0;
+	if (dx == 0 && dy == 0) {
+		for (int ny = -1; ny <= 1; ++ny) {
+			for (int nx = -1; nx <= 1; ++nx) {
+				bool diagonal = nx != 0 && ny != 0;
+				if ((nx != 0 || ny != 0) && (!diagonal || _movement == GridMovement::EightConnected)) {
+					directions[count][0] = nx;
+					directions[count][1] = ny;
+					++count;
+				}
+			}
+		}
+	}
+	else if (dx != 0 && dy != 0) {
+		directions[0][0] = dx; directions[0][1] = 0;
+		directions[1][0] = 0; directions[1][1] = dy;
+		directions[2][0] = dx; directions[2][1] = dy;
+		count = 3;
+	}
+	else {
+		// perpendicular neighbors are kept, a jump point was only created if one of them is forced
+		int px = dy;
+		int py = dx;
+		directions[0][0] = dx; directions[0][1] = dy;
+		directions[1][0] = px; directions[1][1] = py;
+		directions[2][0] = -px; directions[2][1] = -py;
+		count = 3;
+		if (_movement == GridMovement::EightConnected) {
+			directions[3][0] = dx + px; directions[3][1] = dy + py;
+			directions[4][0] = dx - px; directions[4][1] = dy - py;
+			count = 5;
+		}
+	}
+
+	_counters.expanded();
+	for (int i = 0; i < count; ++i) {
+		_counters.generated();
+		int jumpPoint = jump(x, y, directions[i][0], directions[i][1]);
+		if (jumpPoint >= 0) {
+			relaxEdge(minNode, jumpPoint);
+		}
+	}
+
+	return minNode;
+}
+
+SearchResult JumpPointSearch::solve() {
+	while (step() != -1) {
+	}
+
+	int end = _graph->endNode();
+	return makeResult(_graph->startNode(), end, _weightsFromStart[end]);
+}
+
+bool JumpPointSearch::isWalkable(int x, int y)const {
+	return x >= 0 && y >= 0 && x < _graph->width() && y < _graph->height() && !_graph->isBlocked(x, y);
+}
+
+bool JumpPointSearch::canMove(int x, int y, int dx, int dy)const {
+	if (!isWalkable(x + dx, y + dy)) {
+		return false;
+	}
+
+	// diagonal moves need both cells they pass between to be free
+	return dx == 0 || dy == 0 || (isWalkable(x + dx, y) && isWalkable(x, y + dy));
+}
+
+bool JumpPointSearch::hasForcedNeighbor(int x, int y, int dx, int dy)const {
+	// a side cell is forced when the cell behind it is blocked,
+	// then the only shortest way to reach it goes through (x, y)
+	if (dx != 0) {
+		return (isWalkable(x, y - 1) && !isWalkable(x - dx, y - 1)) ||
+			(isWalkable(x, y + 1) && !isWalkable(x - dx, y + 1));
+	}
+
+	return (isWalkable(x - 1, y) && !isWalkable(x - 1, y - dy)) ||
+		(isWalkable(x + 1, y) && !isWalkable(x + 1, y - dy));
+}
+
+int JumpPointSearch::jump(int x, int y, int dx, int dy)const {
+	if (_table != nullptr) {
+		return jumpFromTable(x, y, dx, dy);
+	}
+
+	if (dy == 0) {
+		return jumpHorizontal(x, y, dx);
+	}
+
+	int end = _graph->endNode();
+
+	while (canMove(x, y, dx, dy)) {
+		x += dx;
+		y += dy;
+
+		int node = _graph->index(x, y);
+		if (node == end) {
+			return node;
+		}
+
+		if (dx != 0) {
+			// moving diagonally, stop where a straight jump would find something
+			if (jump(x, y, dx, 0) >= 0 || jump(x, y, 0, dy) >= 0) {
+				return node;
+			}
+		}
+		else if (hasForcedNeighbor(x, y, dx, dy)) {
+			return node;
+		}
+		else if (_movement == GridMovement::FourConnected &&
+			(jump(x, y, 1, 0) >= 0 || jump(x, y, -1, 0) >= 0)) {
+			// without diagonals turning is only possible at a jump point,
+			// so vertical runs stop where a horizontal jump would find something
+			return node;
+		}
+	}
+
+	return -1;
+}
+
+int JumpPointSearch::jumpHorizontal(int x, int y, int dx)const {
+	// same rules as the cell by cell loop, but a whole word of the row is tested at once:
+	// the run stops at the first blocked cell (no jump point), forced neighbor or end node
+	int width = _graph->width();
+	int wordsPerRow = _graph->wordsPerRow();
+	int first = x + dx;
+	if (first < 0 || first >= width) {
+		return -1;
+	}
+
+	int word = first >> 6;
+	while (word >= 0 && word < wordsPerRow) {
+		uint64_t row = freeBits(y, word);
+		uint64_t up = freeBits(y - 1, word);
+		uint64_t down = freeBits(y + 1, word);
+
+		// free bits of the cells behind each cell (in the moving direction)
+		uint64_t upBehind = 0;
+		uint64_t downBehind = 0;
+		uint64_t stops = 0;
+		if (dx > 0) {
+			upBehind = (up << 1) | (word > 0 ? freeBits(y - 1, word - 1) >> 63 : 0);
+			downBehind = (down << 1) | (word > 0 ? freeBits(y + 1, word - 1) >> 63 : 0);
+		}
+		else {
+			upBehind = (up >> 1) | (word + 1 < wordsPerRow ? freeBits(y - 1, word + 1) << 63 : 0);
+			downBehind = (down >> 1) | (word + 1 < wordsPerRow ? freeBits(y + 1, word + 1) << 63 : 0);
+		}
+
+		stops = ~row | (up & ~upBehind) | (down & ~downBehind);
+		if (y == _endY && (_endX >> 6) == word) {
+			stops |= uint64_t(1) << (_endX & 63);
+		}
+
+		// ignore the cells before the first one of the run
+		if (word == first >> 6) {
+			stops &= dx > 0 ? ~uint64_t(0) << (first & 63) : ~uint64_t(0) >> (63 - (first & 63));
+		}
+
+		if (stops != 0) {
+			int bit = dx > 0 ? GridGraph::lowestBit(stops) : GridGraph::highestBit(stops);
+			if (((row >> bit) & 1) == 0) {
+				// a wall (or the border) comes first
+				return -1;
+			}
+
+			return _graph->index((word << 6) + bit, y);
+		}
+
+		word += dx;
+	}
+
+	return -1;
+}
+
+uint64_t JumpPointSearch::freeBits(int y, int word)const {
+	if (y < 0 || y >= _graph->height()) {
+		return 0;
+	}
+
+	uint64_t bits = ~_graph->blockedBits()[y * _graph->wordsPerRow() + word];
+
+	// the padding of the last word of the row is outside the grid
+	int lastBits = _graph->width() & 63;
+	if (word == _graph->wordsPerRow() - 1 && lastBits != 0) {
+		bits &= (uint64_t(1) << lastBits) - 1;
+	}
+
+	return bits;
+}
+
+int JumpPointSearch::jumpFromTable(int x, int y, int dx, int dy)const {
+	int distance = _table->distance(_graph->index(x, y), JumpPointTable::direction(dx, dy));
+	int reach = distance > 0 ? distance : -distance;
+
+	// the end node is not in the table, stop when the run passes by it
+	int toEndX = _endX - x;
+	int toEndY = _endY - y;
+	int stepsToEnd = -1;
+	if (dx != 0 && dy != 0) {
+		// moving diagonally, stop where the end is straight ahead (same row or column)
+		if (sign(toEndX) == dx && sign(toEndY) == dy) {
+			stepsToEnd = std::min(abs(toEndX), abs(toEndY));
+		}
+	}
+	else if (dx != 0) {
+		if (toEndY == 0 && sign(toEndX) == dx) {
+			stepsToEnd = abs(toEndX);
+		}
+	}
+	else if (toEndX == 0 || _movement == GridMovement::FourConnected) {
+		// without diagonals vertical runs also stop on the row of the end, a horizontal jump may reach it
+		if (sign(toEndY) == dy) {
+			stepsToEnd = abs(toEndY);
+		}
+	}
+
+	if (stepsToEnd > 0 && stepsToEnd <= reach) {
+		return _graph->index(x + dx * stepsToEnd, y + dy * stepsToEnd);
+	}
+
+	if (distance > 0) {
+		return _graph->index(x + dx * distance, y + dy * distance);
+	}
+
+	return -1;
+}
+
+void JumpPointSearch::relaxEdge(int u, int v) {
+	float newWeightFromStart = _weightsFromStart[u] + moveCost(u, v);
+	float vWeightFromStart = _weightsFromStart[v];
+
+	if (vWeightFromStart < 0.0f) {
+		// I use weight less than zero like infinite
+		_weightsFromStart[v] = newWeightFromStart;
+		float key = newWeightFromStart + heuristicDistance(v);
+		{
+			SearchCounters::QueueTimer timer(_counters);
+			_queue.insert(v, key);
+		}
+		_counters.inserted(_queue.size());
+		_parents[v] = u;
+	}
+	else if (vWeightFromStart > newWeightFromStart && _queue.contains(v)) {
+		// expanded jump points are final, only the ones still queued are updated
+		_weightsFromStart[v] = newWeightFromStart;
+		float key = newWeightFromStart + heuristicDistance(v);
+		{
+			SearchCounters::QueueTimer timer(_counters);
+			_queue.decreaseKey(v, key);
+		}
+		_counters.decreasedKey();
+		_parents[v] = u;
+	}
+	else {
+		// an expanded jump point, shorter by more than the rounding of the float sums
+		_counters.reachedExpanded(newWeightFromStart < vWeightFromStart - vWeightFromStart * 1e-5f);
+	}
+}
+
+float JumpPointSearch::moveCost(int u, int v)const {
+	int ux = 0;
+	int uy = 0;
+	int vx = 0;
+	int vy = 0;
+	_graph->coordinates(u, ux, uy);
+	_graph->coordinates(v, vx, vy);
+
+	// jumps go in a single direction
+	int dx = abs(vx - ux);
+	int dy = abs(vy - uy);
+	if (dx != 0 && dy != 0) {
+		return GridGraph::diagonalCost * static_cast<float>(dx);
+	}
+
+	return static_cast<float>(dx + dy);
+}
+
+float JumpPointSearch::heuristicDistance(int node)const {
+	int x = 0;
+	int y = 0;
+	_graph->coordinates(node, x, y);
+
+	int dx = abs(_endX - x);
+	int dy = abs(_endY - y);
+	if (_movement == GridMovement::FourConnected) {
+		// Manhattan distance
+		return static_cast<float>(dx + dy);
+	}
+
+	// octile distance
+	return static_cast<float>(std::max(dx, dy)) + (GridGraph::diagonalCost - 1.0f) * static_cast<float>(std::min(dx, dy));
+}
+
+void JumpPointSearch::fillPath() {
+	// parents only link jump points, collect them before filling the cells in between
+	std::vector<int> jumpPoints;
+	for (int node = _graph->endNode(); node >= 0; node = _parents[node]) {
+		jumpPoints.push_back(node);
+	}
+
+	for (size_t i = 0; i + 1 < jumpPoints.size(); ++i) {
+		int fromX = 0;
+		int fromY = 0;
+		int toX = 0;
+		int toY = 0;
+		_graph->coordinates(jumpPoints[i + 1], fromX, fromY);
+		_graph->coordinates(jumpPoints[i], toX, toY);
+
+		int dx = sign(toX - fromX);
+		int dy = sign(toY - fromY);
+
+		int previous = jumpPoints[i + 1];
+		while (previous != jumpPoints[i]) {
+			fromX += dx;
+			fromY += dy;
+			int cell = _graph->index(fromX, fromY);
+			_parents[cell] = previous;
+			previous = cell;
+		}
+	}
+}
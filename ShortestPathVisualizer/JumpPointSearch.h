@@ -0,0 +1,57 @@
+#pragma once
+
+#include "IShortestPathStrategy.h"
+
+#include "DaryHeap.h"
+#include "GridGraph.h"
+#include "JumpPointTable.h"
+#include "SearchStatistics.h"
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+// Jump Point Search (Harabor & Grastien): A* over the grid that only puts jump points in the queue.
+// Straight (and diagonal) runs of cells are skipped while no forced neighbor appears, which removes
+// the symmetric paths plain A* expands on open floors. Only works on uniform cost grids (asserted).
+// Horizontal jumps test 64 cells at a time on the packed obstacle rows of the GridGraph.
+// With a JumpPointTable (JPS+) the jumps are read from the table instead of walking the cells.
+// step() returns the jump points in expansion order. When the end is reached parents() is filled
+// cell by cell along the path (the jumps are straight lines) so drawPath can render it.
+class JumpPointSearch :
+	public IShortestPathStrategy
+{
+public:
+	JumpPointSearch(std::shared_ptr<const GridGraph> graph, size_t capacity, GridMovement movement = GridMovement::FourConnected);
+	// JPS+, the table must have been built for the obstacles of graph (the movement is the one of the table)
+	JumpPointSearch(std::shared_ptr<const GridGraph> graph, std::shared_ptr<const JumpPointTable> table, size_t capacity);
+
+	virtual ~JumpPointSearch() = default;
+
+	int step() override final;
+	SearchResult solve() override final;
+	// generated counts the jumps tried from every expanded jump point
+	SearchStatistics statistics()const override final { return _counters.statistics(); }
+private:
+	void initialize();
+	bool isWalkable(int x, int y)const;
+	bool canMove(int x, int y, int dx, int dy)const;
+	bool hasForcedNeighbor(int x, int y, int dx, int dy)const;
+	int jump(int x, int y, int dx, int dy)const;
+	int jumpHorizontal(int x, int y, int dx)const;
+	uint64_t freeBits(int y, int word)const;
+	int jumpFromTable(int x, int y, int dx, int dy)const;
+	void relaxEdge(int u, int v);
+	float moveCost(int u, int v)const;
+	float heuristicDistance(int node)const;
+	void fillPath();
+
+	std::shared_ptr<const GridGraph> _graph;
+	std::shared_ptr<const JumpPointTable> _table;
+	GridMovement _movement;
+	DaryHeap<4> _queue;
+	std::vector<float> _weightsFromStart;
+	int _endX;
+	int _endY;
+	SearchCounters _counters;
+};
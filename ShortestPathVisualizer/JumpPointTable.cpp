@@ -0,0 +1,227 @@
+#include "JumpPointTable.h"
+
+#include "GridGraph.h"
+
+#include <assert.h>
+#include <chrono>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdint.h>
+#include <vector>
+
+namespace {
+	const uint32_t fileMagic = 0x2B53504A;	// "JPS+"
+	const uint32_t fileVersion = 1;
+
+	template<class T>
+	void write(std::ostream& out, T value) {
+		out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template<class T>
+	bool read(std::istream& in, T& value) {
+		return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+	}
+}
+
+constexpr int JumpPointTable::maxSide;
+
+JumpPointTable::JumpPointTable(std::shared_ptr<const GridGraph> graph, GridMovement movement) :
+	JumpPointTable(graph, movement, hashObstacles(*graph)) {
+	auto begin = std::chrono::steady_clock::now();
+
+	build();
+
+	auto end = std::chrono::steady_clock::now();
+	_buildMilliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+JumpPointTable::JumpPointTable(std::shared_ptr<const GridGraph> graph, GridMovement movement, uint64_t obstaclesHash) :
+	_graph(graph),
+	_movement(movement),
+	_directionCount(movement == GridMovement::FourConnected ? 4 : 8),
+	_obstaclesHash(obstaclesHash),
+	_buildMilliseconds(0.0),
+	_distances(static_cast<size_t>(graph->numberOfNodes()) * _directionCount, 0) {
+	// longer jumps would wrap around in 16 bits
+	assert(supports(*graph));
+}
+
+std::shared_ptr<JumpPointTable> JumpPointTable::load(std::istream& in, std::shared_ptr<const GridGraph> graph) {
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t movement = 0;
+	uint64_t obstaclesHash = 0;
+
+	if (!read(in, magic) || !read(in, version) || !read(in, width) || !read(in, height) ||
+		!read(in, movement) || !read(in, obstaclesHash)) {
+		return nullptr;
+	}
+
+	if (!supports(*graph) || magic != fileMagic || version != fileVersion || width != graph->width() || height != graph->height() ||
+		obstaclesHash != hashObstacles(*graph) ||
+		(movement != static_cast<int32_t>(GridMovement::FourConnected) && movement != static_cast<int32_t>(GridMovement::EightConnected))) {
+		// a table of another map (or of an older version of this one)
+		return nullptr;
+	}
+
+	std::shared_ptr<JumpPointTable> table(new JumpPointTable(graph, static_cast<GridMovement>(movement), obstaclesHash));
+	if (!in.read(reinterpret_cast<char*>(table->_distances.data()), table->sizeInBytes())) {
+		return nullptr;
+	}
+
+	return table;
+}
+
+bool JumpPointTable::save(std::ostream& out)const {
+	// native byte order, the file is meant to be read back on the same machine
+	write(out, fileMagic);
+	write(out, fileVersion);
+	write(out, static_cast<int32_t>(_graph->width()));
+	write(out, static_cast<int32_t>(_graph->height()));
+	write(out, static_cast<int32_t>(_movement));
+	write(out, _obstaclesHash);
+	out.write(reinterpret_cast<const char*>(_distances.data()), sizeInBytes());
+
+	return static_cast<bool>(out);
+}
+
+bool JumpPointTable::matches(const GridGraph& graph)const {
+	return graph.width() == _graph->width() && graph.height() == _graph->height() && hashObstacles(graph) == _obstaclesHash;
+}
+
+int JumpPointTable::direction(int dx, int dy) {
+	for (int direction = 0; direction < 8; ++direction) {
+		if (GridGraph::directionOffsets[direction][0] == dx && GridGraph::directionOffsets[direction][1] == dy) {
+			return direction;
+		}
+	}
+
+	return -1;
+}
+
+void JumpPointTable::build() {
+	// horizontal runs first: in 4-connected mode vertical jump points depend on them,
+	// diagonal jump points depend on every straight direction
+	buildStraight(Left);
+	buildStraight(Right);
+	buildStraight(Up);
+	buildStraight(Down);
+
+	if (_movement == GridMovement::EightConnected) {
+		buildDiagonal(UpLeft);
+		buildDiagonal(UpRight);
+		buildDiagonal(DownLeft);
+		buildDiagonal(DownRight);
+	}
+}
+
+void JumpPointTable::buildStraight(int direction) {
+	int dx = GridGraph::directionOffsets[direction][0];
+	int dy = GridGraph::directionOffsets[direction][1];
+	int width = _graph->width();
+	int height = _graph->height();
+
+	// every cell takes the value of the next one, so cells are visited against the direction
+	int firstX = dx > 0 ? width - 1 : 0;
+	int firstY = dy > 0 ? height - 1 : 0;
+	int stepX = dx > 0 ? -1 : 1;
+	int stepY = dy > 0 ? -1 : 1;
+
+	for (int y = firstY; y >= 0 && y < height; y += stepY) {
+		for (int x = firstX; x >= 0 && x < width; x += stepX) {
+			int nextX = x + dx;
+			int nextY = y + dy;
+			if (!isWalkable(x, y) || !isWalkable(nextX, nextY)) {
+				set(x, y, direction, 0);
+				continue;
+			}
+
+			bool isJumpPoint = hasForcedNeighbor(nextX, nextY, dx, dy);
+			if (!isJumpPoint && _movement == GridMovement::FourConnected && dx == 0) {
+				// without diagonals vertical runs also stop where a horizontal jump finds something
+				int nextNode = _graph->index(nextX, nextY);
+				isJumpPoint = distance(nextNode, Left) > 0 || distance(nextNode, Right) > 0;
+			}
+
+			if (isJumpPoint) {
+				set(x, y, direction, 1);
+			}
+			else {
+				int next = distance(_graph->index(nextX, nextY), direction);
+				set(x, y, direction, next > 0 ? next + 1 : next - 1);
+			}
+		}
+	}
+}
+
+void JumpPointTable::buildDiagonal(int direction) {
+	int dx = GridGraph::directionOffsets[direction][0];
+	int dy = GridGraph::directionOffsets[direction][1];
+	int width = _graph->width();
+	int height = _graph->height();
+	int horizontal = JumpPointTable::direction(dx, 0);
+	int vertical = JumpPointTable::direction(0, dy);
+
+	int firstX = dx > 0 ? width - 1 : 0;
+	int firstY = dy > 0 ? height - 1 : 0;
+	int stepX = dx > 0 ? -1 : 1;
+	int stepY = dy > 0 ? -1 : 1;
+
+	for (int y = firstY; y >= 0 && y < height; y += stepY) {
+		for (int x = firstX; x >= 0 && x < width; x += stepX) {
+			int nextX = x + dx;
+			int nextY = y + dy;
+			// diagonal moves never cut the corner of a blocked cell
+			if (!isWalkable(x, y) || !isWalkable(nextX, nextY) || !isWalkable(nextX, y) || !isWalkable(x, nextY)) {
+				set(x, y, direction, 0);
+				continue;
+			}
+
+			int nextNode = _graph->index(nextX, nextY);
+			if (distance(nextNode, horizontal) > 0 || distance(nextNode, vertical) > 0) {
+				// a straight jump from the next cell finds a jump point
+				set(x, y, direction, 1);
+			}
+			else {
+				int next = distance(nextNode, direction);
+				set(x, y, direction, next > 0 ? next + 1 : next - 1);
+			}
+		}
+	}
+}
+
+bool JumpPointTable::isWalkable(int x, int y)const {
+	return x >= 0 && y >= 0 && x < _graph->width() && y < _graph->height() && !_graph->isBlocked(x, y);
+}
+
+bool JumpPointTable::hasForcedNeighbor(int x, int y, int dx, int dy)const {
+	// same rule as JumpPointSearch: a side cell is forced when the cell behind it is blocked
+	if (dx != 0) {
+		return (isWalkable(x, y - 1) && !isWalkable(x - dx, y - 1)) ||
+			(isWalkable(x, y + 1) && !isWalkable(x - dx, y + 1));
+	}
+
+	return (isWalkable(x - 1, y) && !isWalkable(x - 1, y - dy)) ||
+		(isWalkable(x + 1, y) && !isWalkable(x + 1, y - dy));
+}
+
+void JumpPointTable::set(int x, int y, int direction, int distance) {
+	_distances[static_cast<size_t>(_graph->index(x, y)) * _directionCount + direction] = static_cast<int16_t>(distance);
+}
+
+uint64_t JumpPointTable::hashObstacles(const GridGraph& graph) {
+	// FNV-1a over the packed obstacle rows
+	uint64_t hash = 14695981039346656037ull;
+	for (uint64_t word : graph.blockedBits()) {
+		for (int byte = 0; byte < 8; ++byte) {
+			hash ^= (word >> (byte * 8)) & 0xFF;
+			hash *= 1099511628211ull;
+		}
+	}
+
+	return hash;
+}
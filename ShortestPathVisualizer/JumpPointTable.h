@@ -0,0 +1,78 @@
+#pragma once
+
+#include "GridGraph.h"
+
+#include <iosfwd>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+// JPS+ preprocessing (Rabin): for every cell and direction the distance travelled by a jump
+// from that cell. A positive value d means the jump ends at the jump point d cells away,
+// zero or a negative value -d means there is no jump point and the jump hits a wall after d cells.
+// The end node is not part of the table (it changes between queries), JumpPointSearch checks it
+// while reading the table. Distances are stored in 16 bits, so the sides of the grid can't be longer than
+// maxSide (asserted, check supports() for maps of any size such as MovingAI ones).
+// The table only depends on the obstacles, so it can be saved once per map and loaded afterwards.
+class JumpPointTable
+{
+public:
+	// directions stored per cell (only the first 4 with GridMovement::FourConnected),
+	// in the order of GridGraph::directionOffsets
+	enum Direction
+	{
+		Up = 0,
+		Down,
+		Left,
+		Right,
+		UpLeft,
+		UpRight,
+		DownLeft,
+		DownRight
+	};
+
+	// longest side of a grid the table can store every jump of
+	static constexpr int maxSide = INT16_MAX;
+
+	// builds the table for the obstacles of graph (start and end nodes are not used), graph must be supported
+	JumpPointTable(std::shared_ptr<const GridGraph> graph, GridMovement movement);
+
+	// reads a table written by save(), returns nullptr if the stream is not a table of the same obstacles
+	static std::shared_ptr<JumpPointTable> load(std::istream& in, std::shared_ptr<const GridGraph> graph);
+	bool save(std::ostream& out)const;
+
+	// true if the table was built with the same size and obstacles as graph
+	bool matches(const GridGraph& graph)const;
+	// true if no side of graph is longer than maxSide
+	static bool supports(const GridGraph& graph) { return graph.width() <= maxSide && graph.height() <= maxSide; }
+
+	static int direction(int dx, int dy);
+
+	int distance(int node, int direction)const { return _distances[static_cast<size_t>(node) * _directionCount + direction]; }
+
+	const std::shared_ptr<const GridGraph>& graph()const { return _graph; }
+	GridMovement movement()const { return _movement; }
+	int directionCount()const { return _directionCount; }
+
+	// metrics
+	double buildMilliseconds()const { return _buildMilliseconds; }
+	size_t sizeInBytes()const { return _distances.size() * sizeof(int16_t); }
+private:
+	JumpPointTable(std::shared_ptr<const GridGraph> graph, GridMovement movement, uint64_t obstaclesHash);
+
+	void build();
+	void buildStraight(int direction);
+	void buildDiagonal(int direction);
+	bool isWalkable(int x, int y)const;
+	bool hasForcedNeighbor(int x, int y, int dx, int dy)const;
+	void set(int x, int y, int direction, int distance);
+
+	static uint64_t hashObstacles(const GridGraph& graph);
+
+	std::shared_ptr<const GridGraph> _graph;
+	GridMovement _movement;
+	int _directionCount;
+	uint64_t _obstaclesHash;
+	double _buildMilliseconds;
+	std::vector<int16_t> _distances;
+};
@@ -0,0 +1,263 @@
+#include "Landmarks.h"
+
+#include "IGraph.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+namespace {
+	const uint16_t unreachable16 = 0xFFFF;
+}
+
+constexpr uint32_t Landmarks::unreachable;
+
+Landmarks::Landmarks(std::shared_ptr<const IGraph> graph, int landmarkCount, LandmarkSelection selection) :
+	_graph(graph),
+	_wide(false),
+	_buildMilliseconds(0.0) {
+	auto begin = std::chrono::steady_clock::now();
+
+	// one distance vector per landmark while selecting, store() lays them out node major
+	LandmarkDistances landmarkDistances;
+	if (firstNode() >= 0) {
+		if (selection == LandmarkSelection::Farthest) {
+			selectFarthest(landmarkCount, landmarkDistances);
+		}
+		else {
+			selectAvoid(landmarkCount, landmarkDistances);
+		}
+	}
+	store(landmarkDistances);
+
+	auto end = std::chrono::steady_clock::now();
+	_buildMilliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+int Landmarks::lowerBound(int node, int target)const {
+	std::vector<uint32_t> distances;
+	targetDistances(target, distances);
+
+	return lowerBound(node, distances.data());
+}
+
+int Landmarks::lowerBound(int node, const uint32_t* targetDistances)const {
+	size_t first = static_cast<size_t>(node) * _landmarks.size();
+	if (_wide) {
+		return lowerBound(_distances32.data() + first, targetDistances, unreachable);
+	}
+
+	return lowerBound(_distances16.data() + first, targetDistances, unreachable16);
+}
+
+void Landmarks::targetDistances(int target, std::vector<uint32_t>& distances)const {
+	distances.resize(_landmarks.size());
+	for (size_t landmark = 0; landmark < _landmarks.size(); ++landmark) {
+		distances[landmark] = distance(static_cast<int>(landmark), target);
+	}
+}
+
+uint32_t Landmarks::distance(int landmark, int node)const {
+	size_t index = static_cast<size_t>(node) * _landmarks.size() + landmark;
+	if (_wide) {
+		return _distances32[index];
+	}
+
+	return _distances16[index] == unreachable16 ? unreachable : _distances16[index];
+}
+
+template<class Distance>
+int Landmarks::lowerBound(const Distance* nodeDistances, const uint32_t* targetDistances, uint32_t unreachableValue)const {
+	int bound = 0;
+	for (size_t landmark = 0; landmark < _landmarks.size(); ++landmark) {
+		uint32_t fromNode = nodeDistances[landmark];
+		uint32_t fromTarget = targetDistances[landmark];
+		if (fromNode != unreachableValue && fromTarget != unreachable) {
+			int difference = static_cast<int>(fromNode > fromTarget ? fromNode - fromTarget : fromTarget - fromNode);
+			bound = std::max(bound, difference);
+		}
+	}
+
+	return bound;
+}
+
+void Landmarks::searchFrom(int source, std::vector<uint32_t>& distances, std::vector<int>& order, std::vector<int>& parents)const {
+	int numberOfNodes = _graph->numberOfNodes();
+	distances.assign(numberOfNodes, unreachable);
+	parents.assign(numberOfNodes, -1);
+	order.clear();
+
+	IGraph::NeighborBuffer buffer;
+	distances[source] = 0;
+	order.push_back(source);
+	// order is also the FIFO queue of the search
+	for (size_t head = 0; head < order.size(); ++head) {
+		int node = order[head];
+		for (int adjacent : _graph->neighbors(node, buffer)) {
+			if (distances[adjacent] == unreachable) {
+				distances[adjacent] = distances[node] + 1;
+				parents[adjacent] = node;
+				order.push_back(adjacent);
+			}
+		}
+	}
+}
+
+void Landmarks::selectFarthest(int landmarkCount, LandmarkDistances& landmarkDistances) {
+	int numberOfNodes = _graph->numberOfNodes();
+	std::vector<int> order;
+	std::vector<int> parents;
+
+	// distance from every node to its closest landmark
+	std::vector<uint32_t> closest(numberOfNodes, unreachable);
+
+	// the first landmark is the farthest node from an arbitrary one
+	std::vector<uint32_t> distances;
+	searchFrom(firstNode(), distances, order, parents);
+	int next = order.back();
+
+	for (int landmark = 0; landmark < landmarkCount; ++landmark) {
+		_landmarks.push_back(next);
+		landmarkDistances.push_back(std::vector<uint32_t>());
+		searchFrom(next, landmarkDistances.back(), order, parents);
+
+		// the reached node farthest from every landmark so far
+		for (int node : order) {
+			closest[node] = std::min(closest[node], landmarkDistances.back()[node]);
+			if (closest[node] > closest[next]) {
+				next = node;
+			}
+		}
+	}
+}
+
+void Landmarks::selectAvoid(int landmarkCount, LandmarkDistances& landmarkDistances) {
+	int numberOfNodes = _graph->numberOfNodes();
+	std::vector<uint32_t> distances;
+	std::vector<int> order;
+	std::vector<int> parents;
+	std::vector<uint32_t> sizes(numberOfNodes, 0);
+	std::vector<char> hasLandmark(numberOfNodes, 0);
+	std::vector<char> isLandmark(numberOfNodes, 0);
+	std::vector<int> largestChild(numberOfNodes, -1);
+	std::vector<uint32_t> rootDistances;
+	std::mt19937 random(1);
+
+	// the component of the first node, the first landmark is its farthest node (like Farthest)
+	searchFrom(firstNode(), distances, order, parents);
+	std::vector<int> reachable = order;
+
+	for (int landmark = 0; landmark < landmarkCount; ++landmark) {
+		int next = reachable.back();
+		if (landmark > 0) {
+			// shortest path tree from a random root
+			int root = reachable[std::uniform_int_distribution<size_t>(0, reachable.size() - 1)(random)];
+			searchFrom(root, distances, order, parents);
+
+			rootDistances.resize(landmarkDistances.size());
+			for (size_t l = 0; l < landmarkDistances.size(); ++l) {
+				rootDistances[l] = landmarkDistances[l][root];
+			}
+
+			// weight of a node: how much the current landmarks underestimate its distance to the root,
+			// size of a node: weight of its whole subtree, zero if the subtree already has a landmark
+			for (size_t i = order.size(); i-- > 0;) {
+				int node = order[i];
+				uint32_t bound = 0;
+				for (size_t l = 0; l < landmarkDistances.size(); ++l) {
+					uint32_t fromNode = landmarkDistances[l][node];
+					if (fromNode != unreachable && rootDistances[l] != unreachable) {
+						bound = std::max(bound, fromNode > rootDistances[l] ? fromNode - rootDistances[l] : rootDistances[l] - fromNode);
+					}
+				}
+
+				hasLandmark[node] |= isLandmark[node];
+				sizes[node] = hasLandmark[node] ? 0 : sizes[node] + distances[node] - std::min(bound, distances[node]);
+
+				int parent = parents[node];
+				if (parent >= 0) {
+					hasLandmark[parent] |= hasLandmark[node];
+					sizes[parent] += sizes[node];
+					if (largestChild[parent] < 0 || sizes[node] > sizes[largestChild[parent]]) {
+						largestChild[parent] = node;
+					}
+				}
+			}
+
+			// walk down the largest subtrees up to a leaf
+			next = root;
+			while (largestChild[next] >= 0 && sizes[largestChild[next]] > 0) {
+				next = largestChild[next];
+			}
+
+			if (isLandmark[next]) {
+				// every subtree is covered, take the farthest node from the root that is not a landmark yet
+				for (size_t i = order.size(); i-- > 0 && isLandmark[next];) {
+					next = order[i];
+				}
+			}
+
+			for (int node : order) {
+				sizes[node] = 0;
+				hasLandmark[node] = 0;
+				largestChild[node] = -1;
+			}
+		}
+
+		_landmarks.push_back(next);
+		isLandmark[next] = 1;
+		landmarkDistances.push_back(std::vector<uint32_t>());
+		searchFrom(next, landmarkDistances.back(), order, parents);
+	}
+}
+
+void Landmarks::store(const LandmarkDistances& landmarkDistances) {
+	size_t numberOfNodes = static_cast<size_t>(_graph->numberOfNodes());
+	size_t count = landmarkDistances.size();
+
+	uint32_t longest = 0;
+	for (const auto& distances : landmarkDistances) {
+		for (uint32_t distance : distances) {
+			if (distance != unreachable) {
+				longest = std::max(longest, distance);
+			}
+		}
+	}
+
+	// 16 bits unless a distance would collide with the unreachable mark
+	_wide = longest >= unreachable16;
+	if (_wide) {
+		_distances32.resize(numberOfNodes * count);
+	}
+	else {
+		_distances16.resize(numberOfNodes * count);
+	}
+
+	for (size_t node = 0; node < numberOfNodes; ++node) {
+		for (size_t landmark = 0; landmark < count; ++landmark) {
+			uint32_t distance = landmarkDistances[landmark][node];
+			if (_wide) {
+				_distances32[node * count + landmark] = distance;
+			}
+			else {
+				_distances16[node * count + landmark] = distance == unreachable ? unreachable16 : static_cast<uint16_t>(distance);
+			}
+		}
+	}
+}
+
+int Landmarks::firstNode()const {
+	// first node with an edge (blocked cells of a grid have none)
+	IGraph::NeighborBuffer buffer;
+	for (int node = 0; node < _graph->numberOfNodes(); ++node) {
+		if (!_graph->neighbors(node, buffer).isEmpty()) {
+			return node;
+		}
+	}
+
+	return -1;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "IGraph.h"
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+enum class LandmarkSelection
+{
+	Farthest,	// every landmark is the node farthest from the ones already chosen
+	Avoid		// landmarks go to the regions the current ones bound worst (Goldberg & Werneck)
+};
+
+// ALT preprocessing (A*, Landmarks, Triangle inequality): exact distances from a few landmarks to
+// every node. For any landmark L, |d(L, v) - d(L, t)| <= d(v, t), so the largest of those differences
+// is an admissible and consistent heuristic that knows about walls, unlike the Manhattan distance.
+// Every edge weighs 1 (like in AStar) and the graph must be undirected.
+// Distances are stored node major (the landmarks of a node are contiguous) in 16 bits when the
+// longest one fits, in 32 bits otherwise. Nodes a landmark can't reach are skipped for it.
+class Landmarks
+{
+public:
+	static constexpr uint32_t unreachable = 0xFFFFFFFFu;
+
+	Landmarks(std::shared_ptr<const IGraph> graph, int landmarkCount, LandmarkSelection selection = LandmarkSelection::Farthest);
+
+	// lower bound of the distance from node to target
+	int lowerBound(int node, int target)const;
+	// same bound, with the target distances already copied by targetDistances()
+	int lowerBound(int node, const uint32_t* targetDistances)const;
+	void targetDistances(int target, std::vector<uint32_t>& distances)const;
+
+	int landmarkCount()const { return static_cast<int>(_landmarks.size()); }
+	const std::vector<int>& landmarks()const { return _landmarks; }
+	uint32_t distance(int landmark, int node)const;
+
+	// metrics
+	double buildMilliseconds()const { return _buildMilliseconds; }
+	size_t bytesPerLandmark()const { return static_cast<size_t>(_graph->numberOfNodes()) * (_wide ? sizeof(uint32_t) : sizeof(uint16_t)); }
+	size_t sizeInBytes()const { return _distances16.size() * sizeof(uint16_t) + _distances32.size() * sizeof(uint32_t); }
+private:
+	typedef std::vector<std::vector<uint32_t>> LandmarkDistances;
+
+	// breadth first search from source, order gets the nodes in the order they were reached
+	void searchFrom(int source, std::vector<uint32_t>& distances, std::vector<int>& order, std::vector<int>& parents)const;
+	void selectFarthest(int landmarkCount, LandmarkDistances& landmarkDistances);
+	void selectAvoid(int landmarkCount, LandmarkDistances& landmarkDistances);
+	void store(const LandmarkDistances& landmarkDistances);
+	int firstNode()const;
+
+	template<class Distance>
+	int lowerBound(const Distance* nodeDistances, const uint32_t* targetDistances, uint32_t unreachableValue)const;
+
+	std::shared_ptr<const IGraph> _graph;
+	std::vector<int> _landmarks;
+	bool _wide;
+	std::vector<uint16_t> _distances16;
+	std::vector<uint32_t> _distances32;
+	double _buildMilliseconds;
+};
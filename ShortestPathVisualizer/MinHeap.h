@@ -3,6 +3,7 @@
 #include "Graph.h"
 
 #include <assert.h>
+#include <stddef.h>
 #include <utility>
 #include <vector>
 
@@ -18,6 +19,7 @@ public:
 
 	void insert(ElementType& element);
 	void pop();
+	void clear() { _elements.clear(); }
 
 	const ElementType& top() const;
 	ElementType& top();
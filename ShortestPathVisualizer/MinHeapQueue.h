@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Graph.h"
+#include "MinHeap.h"
+
+#include <vector>
+
+// Adapts MinHeap to the node based priority queue interface used by the strategies:
+//	insert(node, key), decreaseKey(node, key), top(), topKey(), pop()
+// The heap handles (one Graph::Node per graph node) are owned by the queue.
+class MinHeapQueue
+{
+public:
+	typedef float KeyType;
+
+	MinHeapQueue(size_t capacity) :
+		_minHeap(capacity),
+		_handles(capacity) {
+	}
+
+	~MinHeapQueue() = default;
+
+	void insert(int node, float key) {
+		MinHeap::ElementType e;
+		e.first = key;
+		e.second = &_handles[node];
+		e.second->index = node;
+		_minHeap.insert(e);
+	}
+
+	void decreaseKey(int node, float key) { _minHeap.decreaseKey(_handles[node].heapIndex, key); }
+
+	int top()const { return _minHeap.top().second->index; }
+	float topKey()const { return _minHeap.top().first; }
+	void pop() { _minHeap.pop(); }
+	void clear() { _minHeap.clear(); }
+
+	bool isEmpty()const { return _minHeap.isEmpty(); }
+	size_t size()const { return _minHeap.size(); }
+private:
+	MinHeap _minHeap;
+	std::vector<Graph::Node> _handles;
+};
@@ -0,0 +1,46 @@
+#include "QueryRunner.h"
+
+#include "GridGraph.h"
+#include "IShortestPathStrategy.h"
+#include "SearchStatistics.h"
+#include "ShortestPathStrategyFactory.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+QueryRunner::QueryRunner(std::shared_ptr<GridGraph> graph, ShortestPathAlgorithm algorithm) :
+	_graph(graph),
+	_algorithm(algorithm) {
+}
+
+GridQueryResult QueryRunner::run(const GridQuery& query) {
+	_graph->startNode() = _graph->index(query.startX, query.startY);
+	_graph->endNode() = _graph->index(query.endX, query.endY);
+
+	GridQueryResult result;
+	result.expansions = 0;
+
+	auto begin = std::chrono::steady_clock::now();
+	std::unique_ptr<IShortestPathStrategy> search = ShortestPathStrategyFactory::create(_algorithm, _graph, _graph->numberOfNodes());
+	// stepping is what counts the expansions, solve() then only builds the result of the finished search
+	while (search->step() != -1) {
+		++result.expansions;
+	}
+	result.cost = search->solve().distance;
+	auto end = std::chrono::steady_clock::now();
+	result.statistics = search->statistics();
+
+	result.milliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+	return result;
+}
+
+std::vector<GridQueryResult> QueryRunner::run(const std::vector<GridQuery>& queries) {
+	std::vector<GridQueryResult> results;
+	results.reserve(queries.size());
+	for (const GridQuery& query : queries) {
+		results.push_back(run(query));
+	}
+
+	return results;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GridGraph.h"
+#include "SearchStatistics.h"
+#include "ShortestPathStrategyFactory.h"
+
+#include <memory>
+#include <stddef.h>
+#include <vector>
+
+// a search from (startX, startY) to (endX, endY) on a grid
+struct GridQuery {
+	int startX;
+	int startY;
+	int endX;
+	int endY;
+};
+
+// what a query found and how long it took
+struct GridQueryResult {
+	float cost;				// negative if the end can't be reached
+	size_t expansions;		// nodes returned by step()
+	double milliseconds;	// creating the search and running it
+	SearchStatistics statistics;	// 0 unless built with SHORTEST_PATH_STATISTICS
+};
+
+// Runs queries one after the other on the same grid, without anything to draw.
+// The grid is kept: only its start and end are moved to the ones of every query.
+class QueryRunner
+{
+public:
+	QueryRunner(std::shared_ptr<GridGraph> graph, ShortestPathAlgorithm algorithm);
+	~QueryRunner() = default;
+
+	GridQueryResult run(const GridQuery& query);
+	// the results in the order of the queries
+	std::vector<GridQueryResult> run(const std::vector<GridQuery>& queries);
+
+private:
+	std::shared_ptr<GridGraph> _graph;
+	ShortestPathAlgorithm _algorithm;
+};
@@ -0,0 +1,121 @@
+#include "RadixHeap.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+RadixHeap::RadixHeap(size_t capacity) :
+	_keys(capacity, 0),
+	_inQueue(capacity, false),
+	_lastPoppedKey(0),
+	_size(0) {
+}
+
+void RadixHeap::insert(int node, uint32_t key) {
+	assert(!_inQueue[node]);
+
+	_inQueue[node] = true;
+	++_size;
+	push(node, key);
+}
+
+void RadixHeap::decreaseKey(int node, uint32_t key) {
+	assert(_inQueue[node]);
+	assert(key <= _keys[node]);
+
+	// the old entry becomes stale because its key no longer matches
+	push(node, key);
+}
+
+int RadixHeap::top()const {
+	assert(_size > 0);
+
+	settle();
+	return _buckets[0].back().second;
+}
+
+float RadixHeap::topKey()const {
+	assert(_size > 0);
+
+	settle();
+	return static_cast<float>(_buckets[0].back().first);
+}
+
+void RadixHeap::pop() {
+	assert(_size > 0);
+
+	settle();
+	_inQueue[_buckets[0].back().second] = false;
+	_buckets[0].pop_back();
+	--_size;
+}
+
+void RadixHeap::clear() {
+	for (auto& b : _buckets) {
+		for (const auto& entry : b) {
+			_inQueue[entry.second] = false;
+		}
+		b.clear();
+	}
+
+	_lastPoppedKey = 0;
+	_size = 0;
+}
+
+void RadixHeap::push(int node, uint32_t key) {
+	assert(key >= _lastPoppedKey);
+
+	_keys[node] = key;
+	_buckets[bucketIndex(key)].push_back(EntryType(key, node));
+}
+
+void RadixHeap::settle()const {
+	// after settling, if not empty, the back of bucket 0 is a live entry with the minimum key
+	std::vector<EntryType>& first = _buckets[0];
+	while (true) {
+		while (!first.empty() && isStale(first.back())) {
+			first.pop_back();
+		}
+
+		if (!first.empty()) {
+			return;
+		}
+
+		if (_size == 0) {
+			// only stale entries may be left, drop them
+			for (auto& b : _buckets) {
+				b.clear();
+			}
+			return;
+		}
+
+		// find the first non empty bucket and its minimum live key
+		int index = 1;
+		while (_buckets[index].empty()) {
+			++index;
+		}
+
+		std::vector<EntryType>& source = _buckets[index];
+		bool found = false;
+		uint32_t minKey = 0;
+		for (const auto& entry : source) {
+			if (!isStale(entry) && (!found || entry.first < minKey)) {
+				minKey = entry.first;
+				found = true;
+			}
+		}
+
+		if (found) {
+			// redistribute using the new minimum, every live entry goes to a lower bucket
+			_lastPoppedKey = minKey;
+			for (const auto& entry : source) {
+				if (!isStale(entry)) {
+					_buckets[bucketIndex(entry.first)].push_back(entry);
+				}
+			}
+		}
+
+		source.clear();
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+// Radix heap for monotone integer keys (every inserted key >= last popped key).
+// Bucket i holds the entries whose key differs from the last popped key in bit i-1 as highest bit,
+// so an entry moves to a lower bucket at most 32 times. Unlike BucketQueue the keys are not
+// limited to a window, which suits small integer costs with a larger spread.
+// decreaseKey inserts a new entry and the old one is discarded when it is reached (lazy deletion).
+// The minimum is moved into bucket 0 lazily by top()/pop(), after that point inserted keys
+// must not be smaller than topKey().
+// Keys are uint32_t (KeyType), the float overloads are kept for the searches with float costs
+// and must be given integer values.
+class RadixHeap
+{
+public:
+	typedef uint32_t KeyType;
+
+	RadixHeap(size_t capacity);
+	~RadixHeap() = default;
+
+	void insert(int node, uint32_t key);
+	void decreaseKey(int node, uint32_t key);
+	void insert(int node, float key) { insert(node, toIntegerKey(key)); }
+	void decreaseKey(int node, float key) { decreaseKey(node, toIntegerKey(key)); }
+
+	int top()const;
+	float topKey()const;
+	void pop();
+	// empties the heap, O(entries), stale ones included
+	void clear();
+
+	bool isEmpty()const { return _size == 0; }
+	size_t size()const { return _size; }
+private:
+	typedef std::pair<uint32_t, int> EntryType;	// (key, node)
+
+	static const int numberOfBuckets = 33;
+
+	static uint32_t toIntegerKey(float key) {
+		assert(key >= 0.0f && static_cast<float>(static_cast<uint32_t>(key)) == key);
+		return static_cast<uint32_t>(key);
+	}
+
+	int bucketIndex(uint32_t key)const {
+		// position of the highest bit that differs from the last popped key (0 when equal)
+		uint32_t diff = key ^ _lastPoppedKey;
+		int index = 0;
+		while (diff != 0) {
+			diff >>= 1;
+			++index;
+		}
+
+		return index;
+	}
+
+	bool isStale(const EntryType& entry)const { return !_inQueue[entry.second] || _keys[entry.second] != entry.first; }
+
+	void push(int node, uint32_t key);
+	void settle()const;
+
+	mutable std::vector<EntryType> _buckets[numberOfBuckets];
+	std::vector<uint32_t> _keys;
+	std::vector<bool> _inQueue;
+	mutable uint32_t _lastPoppedKey;
+	size_t _size;
+};
@@ -0,0 +1,134 @@
+#include "ScenarioRunner.h"
+
+#include "AStar.h"
+#include "Dijkstra.h"
+#include "GridGraph.h"
+#include "IShortestPathStrategy.h"
+#include "SearchStatistics.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <vector>
+
+constexpr double ScenarioRunner::lengthTolerance;
+
+ScenarioRunner::ScenarioRunner(std::shared_ptr<GridGraph> graph, ShortestPathAlgorithm algorithm) :
+	_graph(graph),
+	_algorithm(algorithm) {
+	assert(algorithm == ShortestPathAlgorithm::Dijkstra || algorithm == ShortestPathAlgorithm::AStar);
+}
+
+ScenarioResult ScenarioRunner::run(const Scenario& scenario) {
+	_graph->startNode() = _graph->index(scenario.query.startX, scenario.query.startY);
+	_graph->endNode() = _graph->index(scenario.query.endX, scenario.query.endY);
+
+	ScenarioResult result;
+	result.expansions = 0;
+
+	auto begin = std::chrono::steady_clock::now();
+	std::unique_ptr<IShortestPathStrategy> search;
+	if (_algorithm == ShortestPathAlgorithm::Dijkstra) {
+		search.reset(new OctileDijkstra<>(_graph, _graph->numberOfNodes()));
+	}
+	else {
+		search.reset(new OctileAStar<>(_graph, _graph->numberOfNodes()));
+	}
+	while (search->step() != -1) {
+		++result.expansions;
+	}
+	SearchResult found = search->solve();
+	auto end = std::chrono::steady_clock::now();
+	result.statistics = search->statistics();
+
+	result.milliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+	// the float distance of the search drifts on long paths, the moves themselves give the exact length
+	result.length = found.path.empty() ? -1.0 : pathLength(*_graph, found.path);
+	result.optimal = std::abs(result.length - scenario.optimalLength) <= lengthTolerance;
+	return result;
+}
+
+std::vector<ScenarioResult> ScenarioRunner::run(const std::vector<Scenario>& scenarios) {
+	std::vector<ScenarioResult> results;
+	results.reserve(scenarios.size());
+	for (const Scenario& scenario : scenarios) {
+		results.push_back(run(scenario));
+	}
+
+	return results;
+}
+
+ScenarioSummary ScenarioRunner::summarize(const std::vector<Scenario>& scenarios, const std::vector<ScenarioResult>& results) {
+	assert(scenarios.size() == results.size());
+
+	ScenarioSummary summary;
+	summary.scenarios = results.size();
+	summary.notOptimal = 0;
+	summary.queriesPerSecond = 0.0;
+	summary.p50Milliseconds = 0.0;
+	summary.p99Milliseconds = 0.0;
+	if (results.empty()) {
+		return summary;
+	}
+
+	std::vector<double> latencies;
+	latencies.reserve(results.size());
+	std::map<int, BucketSummary> buckets;
+	double totalMilliseconds = 0.0;
+	for (size_t i = 0; i < results.size(); ++i) {
+		const ScenarioResult& result = results[i];
+		latencies.push_back(result.milliseconds);
+		totalMilliseconds += result.milliseconds;
+		if (!result.optimal) {
+			++summary.notOptimal;
+		}
+		summary.statistics += result.statistics;
+
+		BucketSummary& bucket = buckets[scenarios[i].bucket];
+		bucket.bucket = scenarios[i].bucket;
+		++bucket.scenarios;
+		bucket.meanExpansions += static_cast<double>(result.expansions);
+		bucket.meanMilliseconds += result.milliseconds;
+	}
+
+	// nearest rank: the smallest latency that at least p of the scenarios don't exceed
+	std::sort(latencies.begin(), latencies.end());
+	auto percentile = [&latencies](double p) {
+		size_t rank = static_cast<size_t>(std::ceil(p * latencies.size()));
+		return latencies[std::max<size_t>(rank, 1) - 1];
+	};
+	summary.p50Milliseconds = percentile(0.50);
+	summary.p99Milliseconds = percentile(0.99);
+	summary.queriesPerSecond = totalMilliseconds > 0.0 ? results.size() * 1000.0 / totalMilliseconds : 0.0;
+
+	for (auto& entry : buckets) {
+		BucketSummary bucket = entry.second;
+		bucket.meanExpansions /= bucket.scenarios;
+		bucket.meanMilliseconds /= bucket.scenarios;
+		summary.buckets.push_back(bucket);
+	}
+
+	return summary;
+}
+
+double ScenarioRunner::pathLength(const GridGraph& graph, const std::vector<int>& path) {
+	const double sqrt2 = std::sqrt(2.0);
+
+	double length = 0.0;
+	for (size_t i = 1; i < path.size(); ++i) {
+		int fromX = 0;
+		int fromY = 0;
+		int toX = 0;
+		int toY = 0;
+		graph.coordinates(path[i - 1], fromX, fromY);
+		graph.coordinates(path[i], toX, toY);
+
+		bool diagonal = fromX != toX && fromY != toY;
+		length += graph.cellCost(path[i]) * (diagonal ? sqrt2 : 1.0);
+	}
+
+	return length;
+}
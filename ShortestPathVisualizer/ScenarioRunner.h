@@ -0,0 +1,76 @@
+#pragma once
+
+#include "GridGraph.h"
+#include "QueryRunner.h"
+#include "SearchStatistics.h"
+#include "ShortestPathStrategyFactory.h"
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+// one line of a MovingAI .scen file
+struct Scenario {
+	int bucket;				// scenarios of a bucket have about the same optimal length
+	std::string map;		// name of the map the file was made for
+	int mapWidth;
+	int mapHeight;
+	GridQuery query;
+	double optimalLength;	// octile length, diagonals cost sqrt(2) and can't cut corners
+};
+
+// what the search found for a scenario and how long it took
+struct ScenarioResult {
+	double length;			// of the path found, added up in double like the file (negative without path)
+	size_t expansions;		// nodes returned by step()
+	double milliseconds;	// creating the search and running it
+	bool optimal;			// the length is the one of the file
+	SearchStatistics statistics;	// 0 unless built with SHORTEST_PATH_STATISTICS
+};
+
+struct BucketSummary {
+	int bucket;
+	size_t scenarios;
+	double meanExpansions;
+	double meanMilliseconds;
+};
+
+struct ScenarioSummary {
+	size_t scenarios;
+	size_t notOptimal;
+	double queriesPerSecond;
+	double p50Milliseconds;
+	double p99Milliseconds;
+	std::vector<BucketSummary> buckets;	// by bucket number
+	SearchStatistics statistics;		// of every scenario added up
+};
+
+// Runs MovingAI scenarios on a grid with the rules the optimal lengths were computed with:
+// 8-connected moves, diagonals cost sqrt(2) and never cut the corner of a blocked cell
+// (OctileDijkstra or OctileAStar with CornerCutting::Never).
+// Like QueryRunner the grid is kept and only its start and end move.
+class ScenarioRunner
+{
+public:
+	// how far a length can be from the one of the file, which is written with 8 decimals
+	static constexpr double lengthTolerance = 1e-4;
+
+	// algorithm is Dijkstra or AStar
+	ScenarioRunner(std::shared_ptr<GridGraph> graph, ShortestPathAlgorithm algorithm);
+	~ScenarioRunner() = default;
+
+	ScenarioResult run(const Scenario& scenario);
+	// the results in the order of the scenarios
+	std::vector<ScenarioResult> run(const std::vector<Scenario>& scenarios);
+
+	// throughput, p50/p99 latency (nearest rank) and the expansions of every bucket
+	static ScenarioSummary summarize(const std::vector<Scenario>& scenarios, const std::vector<ScenarioResult>& results);
+
+	// cost of every move of the path, sqrt(2) times the cost of the cell entered for diagonals
+	static double pathLength(const GridGraph& graph, const std::vector<int>& path);
+
+private:
+	std::shared_ptr<GridGraph> _graph;
+	ShortestPathAlgorithm _algorithm;
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "DaryHeap.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <limits>
+#include <stdint.h>
+#include <vector>
+
+// distance() of the nodes a search didn't reach: the largest value for integer costs,
+// -1 for float costs like the rest of the searches
+template<class Cost>
+struct UnreachedCost {
+	static Cost value() { return std::numeric_limits<Cost>::max(); }
+};
+
+template<>
+struct UnreachedCost<float> {
+	static float value() { return -1.0f; }
+};
+
+// type of the generation stamps: uint16_t costs get uint16_t stamps so a slot takes 8 bytes instead of 12,
+// the generation then wraps around every 32766 searches, which costs one clear of the slots
+template<class Cost>
+struct SlotStamp {
+	typedef uint32_t Type;
+};
+
+template<>
+struct SlotStamp<uint16_t> {
+	typedef uint16_t Type;
+};
+
+// State of a best first search that outlives it: distance, parent and closed flag of every node
+// plus the priority queue. A search constructed with a context borrows it instead of allocating its own,
+// so a worker can run many short queries on a large graph without allocating or clearing per query.
+// Every node slot carries the generation that wrote it and only slots of the current generation are
+// valid, so reset() is O(1) (plus the entries the last search left in the queue). Slots are only
+// cleared when the generation counter wraps around.
+// PriorityQueue can be DaryHeap<2/4/8>, MinHeapQueue, BucketQueue or RadixHeap, Cost float, uint16_t or uint32_t.
+template<class PriorityQueue = DaryHeap<4>, class Cost = float>
+class SearchContext
+{
+public:
+	SearchContext(size_t capacity);
+	~SearchContext() = default;
+
+	// forgets the last search
+	void reset();
+
+	size_t capacity()const { return _slots.size(); }
+	// memory taken by the slot of a node (the queue not included)
+	static size_t bytesPerNode() { return sizeof(Slot); }
+
+	// reached by the current search (open or closed)
+	bool isReached(int node)const { return _slots[node].stamp >= _generation; }
+	bool isClosed(int node)const { return _slots[node].stamp == _generation + 1; }
+
+	// UnreachedCost if the current search didn't reach node
+	Cost distance(int node)const { return isReached(node) ? _slots[node].distance : UnreachedCost<Cost>::value(); }
+	int parent(int node)const { return isReached(node) ? _slots[node].parent : -1; }
+
+	// node is open with distance, coming from parent
+	void reach(int node, Cost distance, int parent) {
+		Slot& slot = _slots[node];
+		slot.stamp = _generation;
+		slot.distance = distance;
+		slot.parent = parent;
+	}
+
+	void close(int node) {
+		assert(isReached(node));
+		_slots[node].stamp = static_cast<Stamp>(_generation + 1);
+	}
+
+	PriorityQueue& queue() { return _queue; }
+	const PriorityQueue& queue()const { return _queue; }
+private:
+	typedef typename SlotStamp<Cost>::Type Stamp;
+
+	// the fields of a node are read together, one slot is one cache access
+	struct Slot {
+		Stamp stamp;		// generation when reached, generation + 1 once closed
+		Cost distance;
+		int parent;
+	};
+
+	std::vector<Slot> _slots;
+	Stamp _generation;		// even, stamps of older searches are below it
+	PriorityQueue _queue;
+};
+
+template<class PriorityQueue, class Cost>
+SearchContext<PriorityQueue, Cost>::SearchContext(size_t capacity) :
+	_slots(capacity, Slot{ 0, UnreachedCost<Cost>::value(), -1 }),
+	_generation(2),
+	_queue(capacity) {
+}
+
+template<class PriorityQueue, class Cost>
+void SearchContext<PriorityQueue, Cost>::reset() {
+	_queue.clear();
+
+	if (_generation >= std::numeric_limits<Stamp>::max() - 3) {
+		// the stamps would wrap around and old slots would look current, start over from clean slots
+		std::fill(_slots.begin(), _slots.end(), Slot{ 0, UnreachedCost<Cost>::value(), -1 });
+		_generation = 2;
+		return;
+	}
+
+	_generation = static_cast<Stamp>(_generation + 2);
+}
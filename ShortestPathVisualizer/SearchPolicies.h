@@ -0,0 +1,207 @@
+#pragma once
+
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "Landmarks.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+// Policies of BestFirstSearch.
+// A heuristic is given the end node once (target) and then estimates the cost from a node to it.
+// An expansion calls visit(neighbor, edgeCost) for every edge leaving a node.
+// Their functions are templates on the graph type, so for a concrete graph (GridGraph) the
+// functions of the graph are called directly and everything is inlined in the search loop.
+
+// no estimate, the search is Dijkstra
+class ZeroHeuristic
+{
+public:
+	template<class Graph>
+	void target(const Graph&, int) {
+	}
+
+	template<class Cost, class Graph>
+	Cost estimate(const Graph&, int)const {
+		return Cost(0);
+	}
+};
+
+// Manhattan distance to the end, raised to the ALT bound of landmarks when there are any
+// (the largest of both, still an integer and still consistent for 4-connected unit moves).
+// Both count moves, they are multiplied by the minimum edge weight of the graph so they stay
+// admissible on weighted terrain (1 on unweighted graphs).
+class ManhattanHeuristic
+{
+public:
+	ManhattanHeuristic() :
+		_endX(0),
+		_endY(0),
+		_minimumWeight(1) {
+	}
+
+	// landmarks must have been built for the graph searched
+	explicit ManhattanHeuristic(std::shared_ptr<const Landmarks> landmarks) :
+		_landmarks(landmarks),
+		_endX(0),
+		_endY(0),
+		_minimumWeight(1) {
+	}
+
+	template<class Graph>
+	void target(const Graph& graph, int end) {
+		// keep the end node coordinates at hand, and its landmark distances which are needed for every estimate
+		graph.coordinates(end, _endX, _endY);
+		_minimumWeight = graph.minimumEdgeWeight();
+		if (_landmarks != nullptr) {
+			_landmarks->targetDistances(end, _endLandmarkDistances);
+		}
+	}
+
+	template<class Cost, class Graph>
+	Cost estimate(const Graph& graph, int node)const {
+		int x = 0;
+		int y = 0;
+		graph.coordinates(node, x, y);
+
+		int manhattan = std::abs(_endX - x) + std::abs(_endY - y);
+		if (_landmarks == nullptr) {
+			return static_cast<Cost>(_minimumWeight * manhattan);
+		}
+
+		return static_cast<Cost>(_minimumWeight * std::max(manhattan, _landmarks->lowerBound(node, _endLandmarkDistances.data())));
+	}
+private:
+	std::shared_ptr<const Landmarks> _landmarks;
+	int _endX;
+	int _endY;
+	int _minimumWeight;
+	std::vector<uint32_t> _endLandmarkDistances;
+};
+
+// octile distance to the end (straight moves cost 1 and diagonal ones sqrt(2)) for 8-connected grids,
+// scaled by the minimum edge weight like ManhattanHeuristic
+class OctileHeuristic
+{
+public:
+	OctileHeuristic() :
+		_endX(0),
+		_endY(0),
+		_minimumWeight(1) {
+	}
+
+	template<class Graph>
+	void target(const Graph& graph, int end) {
+		graph.coordinates(end, _endX, _endY);
+		_minimumWeight = graph.minimumEdgeWeight();
+	}
+
+	template<class Cost, class Graph>
+	Cost estimate(const Graph& graph, int node)const {
+		int x = 0;
+		int y = 0;
+		graph.coordinates(node, x, y);
+
+		int dx = std::abs(_endX - x);
+		int dy = std::abs(_endY - y);
+		float octile = static_cast<float>(std::max(dx, dy)) + (GridGraph::diagonalCost - 1.0f) * static_cast<float>(std::min(dx, dy));
+		return static_cast<Cost>(_minimumWeight * octile);
+	}
+private:
+	int _endX;
+	int _endY;
+	int _minimumWeight;
+};
+
+// the edges of neighbors(), every edge costs 1
+class UnitEdges
+{
+public:
+	template<class Cost, class Graph, class Visit>
+	void expand(const Graph& graph, int node, Visit visit) {
+		for (int neighbor : graph.neighbors(node, _neighborBuffer)) {
+			visit(neighbor, Cost(1));
+		}
+	}
+private:
+	IGraph::NeighborBuffer _neighborBuffer;
+};
+
+// the edges of neighbors() with their weights (terrain costs on a GridGraph)
+class WeightedEdges
+{
+public:
+	template<class Cost, class Graph, class Visit>
+	void expand(const Graph& graph, int node, Visit visit) {
+		for (int neighbor : graph.neighbors(node, _neighborBuffer)) {
+			visit(neighbor, static_cast<Cost>(graph.edgeWeight(node, neighbor)));
+		}
+	}
+private:
+	IGraph::NeighborBuffer _neighborBuffer;
+};
+
+// the 8 neighbors of a cell of a GridGraph, read from the obstacle bits instead of neighbors():
+// straight moves cost the terrain cost of the cell entered, diagonal ones sqrt(2) times it.
+// The directions come from the constexpr GridGraph::directionOffsets and Cutting is known at compile time,
+// so both loops are unrolled. Diagonal costs are not integers, Cost must be float
+template<CornerCutting Cutting = CornerCutting::Never>
+class EightConnectedEdges
+{
+public:
+	template<class Cost, class Graph, class Visit>
+	void expand(const Graph& graph, int node, Visit visit) {
+		static_assert(std::is_floating_point<Cost>::value, "diagonal moves cost sqrt(2), EightConnectedEdges needs float costs");
+
+		int x = 0;
+		int y = 0;
+		graph.coordinates(node, x, y);
+		if (graph.isBlocked(x, y)) {
+			// blocked cells have no edges, like in neighbors()
+			return;
+		}
+
+		bool free[8];
+		for (int direction = 0; direction < 8; ++direction) {
+			int neighborX = x + GridGraph::directionOffsets[direction][0];
+			int neighborY = y + GridGraph::directionOffsets[direction][1];
+			free[direction] = neighborX >= 0 && neighborX < graph.width() && neighborY >= 0 && neighborY < graph.height() &&
+				!graph.isBlocked(neighborX, neighborY);
+		}
+
+		for (int direction = 0; direction < 4; ++direction) {
+			if (free[direction]) {
+				int neighbor = graph.index(x + GridGraph::directionOffsets[direction][0], y + GridGraph::directionOffsets[direction][1]);
+				visit(neighbor, static_cast<Cost>(graph.cellCost(neighbor)));
+			}
+		}
+
+		for (int direction = 4; direction < 8; ++direction) {
+			int dx = GridGraph::directionOffsets[direction][0];
+			int dy = GridGraph::directionOffsets[direction][1];
+			// the cells the move goes between, straight up/down (0/1) and left/right (2/3)
+			bool verticalFree = free[dy < 0 ? 0 : 1];
+			bool horizontalFree = free[dx < 0 ? 2 : 3];
+			if (free[direction] && canCut(verticalFree, horizontalFree)) {
+				int neighbor = graph.index(x + dx, y + dy);
+				visit(neighbor, static_cast<Cost>(GridGraph::diagonalCost * graph.cellCost(neighbor)));
+			}
+		}
+	}
+private:
+	static bool canCut(bool verticalFree, bool horizontalFree) {
+		switch (Cutting)
+		{
+		case CornerCutting::Never:
+			return verticalFree && horizontalFree;
+		case CornerCutting::OneCorner:
+			return verticalFree || horizontalFree;
+		default:
+			return true;
+		}
+	}
+};
@@ -0,0 +1,54 @@
+#include "SearchStatistics.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+SearchStatistics::SearchStatistics() :
+	expanded(0),
+	generated(0),
+	inserts(0),
+	pops(0),
+	decreaseKeys(0),
+	maxQueueSize(0),
+	reopenings(0),
+	expansionMilliseconds(0.0),
+	queueMilliseconds(0.0) {
+}
+
+SearchStatistics& SearchStatistics::operator+=(const SearchStatistics& other) {
+	expanded += other.expanded;
+	generated += other.generated;
+	inserts += other.inserts;
+	pops += other.pops;
+	decreaseKeys += other.decreaseKeys;
+	maxQueueSize = std::max(maxQueueSize, other.maxQueueSize);
+	reopenings += other.reopenings;
+	expansionMilliseconds += other.expansionMilliseconds;
+	queueMilliseconds += other.queueMilliseconds;
+
+	return *this;
+}
+
+bool SearchStatistics::enabled() {
+#ifdef SHORTEST_PATH_STATISTICS
+	return true;
+#else
+	return false;
+#endif
+}
+
+void printStatistics(std::ostream& output, const SearchStatistics& statistics, const char* indent) {
+	output << indent << "Expanded: " << statistics.expanded << std::endl;
+	output << indent << "Generated: " << statistics.generated << std::endl;
+	output << indent << "Queue inserts: " << statistics.inserts << ", pops: " << statistics.pops << ", decreaseKeys: " << statistics.decreaseKeys << std::endl;
+	output << indent << "Max queue size: " << statistics.maxQueueSize << std::endl;
+	output << indent << "Reopenings: " << statistics.reopenings << std::endl;
+
+	std::ios::fmtflags flags = output.flags();
+	std::streamsize precision = output.precision();
+	output << std::fixed << std::setprecision(3);
+	output << indent << "Expansion ms: " << statistics.expansionMilliseconds << ", queue ms: " << statistics.queueMilliseconds << std::endl;
+	output.flags(flags);
+	output.precision(precision);
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <stddef.h>
+
+// What a search did so far, read through IShortestPathStrategy::statistics().
+// The searches only count when the solution is built with SHORTEST_PATH_STATISTICS defined,
+// otherwise the counting code is not compiled at all and every field stays 0.
+// Define it for every project of the solution: the searches are templates compiled into each of them.
+struct SearchStatistics {
+	size_t expanded;		// nodes popped and expanded (the end node is popped, not expanded)
+	size_t generated;		// edges looked at while expanding
+	size_t inserts;
+	size_t pops;
+	size_t decreaseKeys;
+	size_t maxQueueSize;
+	// edges that found a shorter way to a node already expanded. The searches keep the distance of an
+	// expanded node (a consistent heuristic makes it final), so anything but 0 means an inconsistent heuristic
+	size_t reopenings;
+	double expansionMilliseconds;	// in step() / solve() but not in the queue
+	double queueMilliseconds;		// in the queue operations (timing them slows the search down)
+
+	SearchStatistics();
+
+	// adds the counters of other, maxQueueSize keeps the largest
+	SearchStatistics& operator+=(const SearchStatistics& other);
+
+	// true when built with SHORTEST_PATH_STATISTICS
+	static bool enabled();
+};
+
+// one line per counter, indented by indent
+void printStatistics(std::ostream& output, const SearchStatistics& statistics, const char* indent = "");
+
+#ifdef SHORTEST_PATH_STATISTICS
+
+// The counters a search updates as it goes, SearchCounters::QueueTimer and ExpansionTimer time the
+// scope they live in
+class SearchCounters
+{
+public:
+	class QueueTimer
+	{
+	public:
+		QueueTimer(SearchCounters& counters) :
+			_milliseconds(counters._statistics.queueMilliseconds),
+			_begin(std::chrono::steady_clock::now()) {
+		}
+		~QueueTimer() { _milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _begin).count(); }
+	private:
+		double& _milliseconds;
+		std::chrono::steady_clock::time_point _begin;
+	};
+
+	// the whole expansion, the queue time inside it is taken out by statistics()
+	class ExpansionTimer
+	{
+	public:
+		ExpansionTimer(SearchCounters& counters) :
+			_milliseconds(counters._statistics.expansionMilliseconds),
+			_begin(std::chrono::steady_clock::now()) {
+		}
+		~ExpansionTimer() { _milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _begin).count(); }
+	private:
+		double& _milliseconds;
+		std::chrono::steady_clock::time_point _begin;
+	};
+
+	void expanded() { ++_statistics.expanded; }
+	void generated() { ++_statistics.generated; }
+	void inserted(size_t queueSize) {
+		++_statistics.inserts;
+		if (queueSize > _statistics.maxQueueSize) {
+			_statistics.maxQueueSize = queueSize;
+		}
+	}
+	void popped() { ++_statistics.pops; }
+	void decreasedKey() { ++_statistics.decreaseKeys; }
+	// an edge to an expanded node, shorter tells if it found a shorter way to it
+	void reachedExpanded(bool shorter) {
+		if (shorter) {
+			++_statistics.reopenings;
+		}
+	}
+
+	SearchStatistics statistics()const {
+		SearchStatistics statistics = _statistics;
+		statistics.expansionMilliseconds -= statistics.queueMilliseconds;
+		return statistics;
+	}
+private:
+	SearchStatistics _statistics;
+};
+
+#else
+
+// without SHORTEST_PATH_STATISTICS every call is empty and disappears when inlined
+class SearchCounters
+{
+public:
+	class QueueTimer
+	{
+	public:
+		QueueTimer(SearchCounters&) {}
+	};
+
+	class ExpansionTimer
+	{
+	public:
+		ExpansionTimer(SearchCounters&) {}
+	};
+
+	void expanded() {}
+	void generated() {}
+	void inserted(size_t) {}
+	void popped() {}
+	void decreasedKey() {}
+	void reachedExpanded(bool) {}
+
+	SearchStatistics statistics()const { return SearchStatistics(); }
+};
+
+#endif
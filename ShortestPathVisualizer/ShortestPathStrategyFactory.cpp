@@ -0,0 +1,54 @@
+#include "ShortestPathStrategyFactory.h"
+
+#include "AStar.h"
+#include "BidirectionalSearch.h"
+#include "BreadthFirstSearch.h"
+#include "BucketQueue.h"
+#include "Dijkstra.h"
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "IShortestPathStrategy.h"
+#include "JumpPointSearch.h"
+#include "RadixHeap.h"
+
+#include <memory>
+
+std::unique_ptr<IShortestPathStrategy> ShortestPathStrategyFactory::create(ShortestPathAlgorithm algorithm, std::shared_ptr<const IGraph> graph, size_t capacity) {
+	bool uniformWeights = graph->hasUniformEdgeWeights();
+
+	switch (algorithm)
+	{
+	case ShortestPathAlgorithm::Dijkstra:
+		if (uniformWeights) {
+			return std::unique_ptr<IShortestPathStrategy>(new BreadthFirstSearch(graph, capacity));
+		}
+		return std::unique_ptr<IShortestPathStrategy>(new WeightedDijkstra<RadixHeap>(graph, capacity));
+	case ShortestPathAlgorithm::AStar:
+		if (!uniformWeights) {
+			return std::unique_ptr<IShortestPathStrategy>(new WeightedAStar<RadixHeap>(graph, capacity));
+		}
+		if (auto gridGraph = std::dynamic_pointer_cast<const GridGraph>(graph)) {
+			return std::unique_ptr<IShortestPathStrategy>(new IntegerGridAStar<BucketQueue>(gridGraph, capacity));
+		}
+		return std::unique_ptr<IShortestPathStrategy>(new IntegerAStar<BucketQueue>(graph, capacity));
+	case ShortestPathAlgorithm::BidirectionalDijkstra:
+		if (uniformWeights) {
+			return std::unique_ptr<IShortestPathStrategy>(new BidirectionalDijkstra<BucketQueue>(graph, capacity));
+		}
+		return create(ShortestPathAlgorithm::Dijkstra, graph, capacity);
+	case ShortestPathAlgorithm::BidirectionalAStar:
+		if (uniformWeights) {
+			return std::unique_ptr<IShortestPathStrategy>(new BidirectionalAStar<BucketQueue>(graph, capacity));
+		}
+		return create(ShortestPathAlgorithm::AStar, graph, capacity);
+	case ShortestPathAlgorithm::JumpPointSearch:
+		if (auto gridGraph = std::dynamic_pointer_cast<const GridGraph>(graph)) {
+			if (uniformWeights) {
+				return std::unique_ptr<IShortestPathStrategy>(new ::JumpPointSearch(gridGraph, capacity));
+			}
+		}
+		return create(ShortestPathAlgorithm::AStar, graph, capacity);
+	default:
+		return nullptr;
+	}
+}
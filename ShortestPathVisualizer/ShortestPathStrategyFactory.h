@@ -0,0 +1,29 @@
+#pragma once
+
+#include "IGraph.h"
+#include "IShortestPathStrategy.h"
+
+#include <memory>
+
+enum class ShortestPathAlgorithm
+{
+	Dijkstra,
+	AStar,
+	BidirectionalDijkstra,
+	BidirectionalAStar,
+	JumpPointSearch
+};
+
+// Picks the fastest implementation of the requested algorithm for the given graph:
+//	- Dijkstra on a graph whose edges all weigh the same is a breadth first search
+//	- A* on such a graph uses integer costs and keys (IntegerAStar), so the bucket queue replaces the heap
+//	  (on a GridGraph it is compiled for the grid, IntegerGridAStar, without virtual calls)
+//	- the same goes for both sides of the bidirectional searches
+//	- jump point search needs the obstacle bits of a GridGraph, any other graph falls back to A*
+//	- with weighted edges (terrain costs) Dijkstra and A* follow the weights on a radix heap,
+//	  the bidirectional searches and jump point search only know unit moves and fall back to them
+class ShortestPathStrategyFactory
+{
+public:
+	static std::unique_ptr<IShortestPathStrategy> create(ShortestPathAlgorithm algorithm, std::shared_ptr<const IGraph> graph, size_t capacity);
+};
@@ -0,0 +1,227 @@
+#pragma once
+
+// Grids, graphs and reference searches shared by the *_tests.cpp files (not part of any project)
+
+#include "BreadthFirstSearch.h"
+#include "Graph.h"
+#include "GraphBuilder.h"
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "IShortestPathStrategy.h"
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stdlib.h>
+#include <utility>
+#include <vector>
+
+// width x height cells, obstaclePercent of them blocked at random, start and end where GridGraph puts them
+inline std::shared_ptr<GridGraph> createRandomObstacles(int width, int height, int obstaclePercent, std::mt19937& random) {
+	std::uniform_int_distribution<int> percent(0, 99);
+
+	auto graph = std::make_shared<GridGraph>(width, height);
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			graph->setBlocked(x, y, percent(random) < obstaclePercent);
+		}
+	}
+
+	return graph;
+}
+
+inline std::shared_ptr<GridGraph> createRandomObstacles(int width, int height, int obstaclePercent, unsigned int seed) {
+	std::mt19937 random(seed);
+	return createRandomObstacles(width, height, obstaclePercent, random);
+}
+
+// random obstacles, the start and end at random cells (cleared if they were blocked)
+inline std::shared_ptr<GridGraph> createRandomGrid(int width, int height, int obstaclePercent, unsigned int seed) {
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<int> cell(0, width * height - 1);
+
+	std::shared_ptr<GridGraph> graph = createRandomObstacles(width, height, obstaclePercent, random);
+	graph->startNode() = cell(random);
+	graph->endNode() = cell(random);
+	graph->setBlocked(graph->startNode() % width, graph->startNode() / width, false);
+	graph->setBlocked(graph->endNode() % width, graph->endNode() / width, false);
+
+	return graph;
+}
+
+// numberOfEdges random undirected edges (self loops dropped), start and end left at -1
+inline std::shared_ptr<Graph> createRandomGraph(int numberOfNodes, int numberOfEdges, unsigned int seed) {
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<int> node(0, numberOfNodes - 1);
+
+	GraphBuilder builder(numberOfNodes);
+	for (int i = 0; i < numberOfNodes; ++i) {
+		builder.nodes().push_back(Graph::Node{ i, i, 0, -1 });
+		builder.adjacencyList().push_back(std::list<int>());
+	}
+	for (int i = 0; i < numberOfEdges; ++i) {
+		int from = node(random);
+		int to = node(random);
+		if (from != to) {
+			builder.adjacencyList()[from].push_back(to);
+			builder.adjacencyList()[to].push_back(from);
+		}
+	}
+
+	return builder.build();
+}
+
+// steps until -1, returns the number of nodes expanded
+template<class Search>
+int expandAll(Search& search) {
+	int expanded = 0;
+	while (search.step() != -1) {
+		++expanded;
+	}
+
+	return expanded;
+}
+
+// length of the shortest path between the start and the end of graph with BreadthFirstSearch, -1 if not reachable
+inline int referenceDistance(std::shared_ptr<const IGraph> graph) {
+	BreadthFirstSearch search(graph, graph->numberOfNodes());
+	expandAll(search);
+
+	int distance = 0;
+	int current = graph->endNode();
+	while (current != graph->startNode() && current >= 0) {
+		current = search.parents()[current];
+		++distance;
+	}
+
+	return current == graph->startNode() ? distance : -1;
+}
+
+// distance to every node from source with BreadthFirstSearch (following parents), -1 if not reachable
+inline std::vector<int> referenceDistances(const GridGraph& graph, int source) {
+	auto copy = std::make_shared<GridGraph>(graph);
+	copy->startNode() = source;
+	copy->endNode() = -1;
+
+	BreadthFirstSearch search(copy, copy->numberOfNodes());
+	expandAll(search);
+
+	std::vector<int> distances(copy->numberOfNodes(), -1);
+	for (int node = 0; node < copy->numberOfNodes(); ++node) {
+		int distance = 0;
+		int current = node;
+		while (current != source && current >= 0) {
+			current = search.parents()[current];
+			++distance;
+		}
+		distances[node] = current == source ? distance : -1;
+	}
+
+	return distances;
+}
+
+// true if the parents of search are a path of graph from its start to its end with the given number of edges
+inline bool isPathOfGraph(const IGraph& graph, const IShortestPathStrategy& search, int length) {
+	IGraph::NeighborBuffer buffer;
+	int current = graph.endNode();
+	for (int edges = 0; edges < length; ++edges) {
+		int parent = search.parents()[current];
+		if (parent < 0) {
+			return false;
+		}
+
+		bool adjacent = false;
+		for (int neighbor : graph.neighbors(parent, buffer)) {
+			adjacent = adjacent || neighbor == current;
+		}
+		if (!adjacent) {
+			return false;
+		}
+		current = parent;
+	}
+
+	return current == graph.startNode();
+}
+
+// (x, y) is inside graph and not blocked
+inline bool isWalkable(const GridGraph& graph, int x, int y) {
+	return x >= 0 && y >= 0 && x < graph.width() && y < graph.height() && !graph.isBlocked(x, y);
+}
+
+// cost of the path in parents from start to end (negative if there is no valid path)
+inline double pathCost(const GridGraph& graph, const std::vector<int>& parents, GridMovement movement) {
+	if (graph.startNode() == graph.endNode()) {
+		return 0.0;
+	}
+
+	double cost = 0.0;
+	int current = graph.endNode();
+	while (current != graph.startNode()) {
+		int parent = parents[current];
+		if (parent < 0) {
+			return -1.0;
+		}
+
+		int x = 0;
+		int y = 0;
+		int parentX = 0;
+		int parentY = 0;
+		graph.coordinates(current, x, y);
+		graph.coordinates(parent, parentX, parentY);
+
+		// every step goes to an adjacent free cell (diagonals only without cutting corners)
+		int dx = x - parentX;
+		int dy = y - parentY;
+		bool diagonal = dx != 0 && dy != 0;
+		if (abs(dx) > 1 || abs(dy) > 1 || (dx == 0 && dy == 0) || !isWalkable(graph, x, y) ||
+			(diagonal && (movement == GridMovement::FourConnected || !isWalkable(graph, parentX + dx, parentY) || !isWalkable(graph, parentX, parentY + dy)))) {
+			return -2.0;
+		}
+
+		cost += diagonal ? 1.41421356 : 1.0;
+		current = parent;
+	}
+
+	return cost;
+}
+
+// shortest path cost with a plain Dijkstra over the cells (negative if the end is not reachable)
+inline double referenceCost(const GridGraph& graph, GridMovement movement) {
+	typedef std::pair<double, int> Entry;
+	std::vector<double> costs(graph.numberOfNodes(), -1.0);
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+
+	costs[graph.startNode()] = 0.0;
+	queue.push(Entry(0.0, graph.startNode()));
+	while (!queue.empty()) {
+		Entry entry = queue.top();
+		queue.pop();
+		if (entry.first > costs[entry.second]) {
+			continue;
+		}
+
+		int x = 0;
+		int y = 0;
+		graph.coordinates(entry.second, x, y);
+		for (int dy = -1; dy <= 1; ++dy) {
+			for (int dx = -1; dx <= 1; ++dx) {
+				bool diagonal = dx != 0 && dy != 0;
+				if ((dx == 0 && dy == 0) || !isWalkable(graph, x + dx, y + dy) ||
+					(diagonal && (movement == GridMovement::FourConnected || !isWalkable(graph, x + dx, y) || !isWalkable(graph, x, y + dy)))) {
+					continue;
+				}
+
+				int next = graph.index(x + dx, y + dy);
+				double cost = entry.first + (diagonal ? 1.41421356 : 1.0);
+				if (costs[next] < 0.0 || cost < costs[next] - 1e-9) {
+					costs[next] = cost;
+					queue.push(Entry(cost, next));
+				}
+			}
+		}
+	}
+
+	return costs[graph.endNode()];
+}
@@ -0,0 +1,165 @@
+#include "BatchQueryRunner.h"
+#include "GridGraph.h"
+#include "QueryRunner.h"
+#include "ShortestPathStrategyFactory.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_costs_match_query_runner();
+bool test_costs_match_on_terrain();
+bool test_grid_is_not_modified();
+bool test_batches_reuse_the_workers();
+bool test_more_threads_than_queries();
+
+// queries between random free cells, a few of them from a cell to itself
+std::vector<GridQuery> createRandomQueries(const GridGraph& graph, int count, unsigned int seed);
+// the batch against QueryRunner (one query after the other, moving the start and end of a copy of graph)
+bool sameCostsAsQueryRunner(std::shared_ptr<GridGraph> graph, ShortestPathAlgorithm algorithm, unsigned int threads, const std::vector<GridQuery>& queries);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 5;
+
+	TEST(test_costs_match_query_runner, errCount, okCount);
+	TEST(test_costs_match_on_terrain, errCount, okCount);
+	TEST(test_grid_is_not_modified, errCount, okCount);
+	TEST(test_batches_reuse_the_workers, errCount, okCount);
+	TEST(test_more_threads_than_queries, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_costs_match_query_runner() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 3 && ok; ++seed) {
+		auto graph = createRandomObstacles(60, 40, 25, seed);
+		std::vector<GridQuery> queries = createRandomQueries(*graph, 200, seed);
+
+		for (unsigned int threads : { 1u, 3u, 8u }) {
+			ok = ok && sameCostsAsQueryRunner(graph, ShortestPathAlgorithm::Dijkstra, threads, queries) &&
+				sameCostsAsQueryRunner(graph, ShortestPathAlgorithm::AStar, threads, queries);
+		}
+	}
+
+	return ok;
+}
+
+bool test_costs_match_on_terrain() {
+	auto graph = createRandomObstacles(50, 50, 15, 4);
+	std::mt19937 random(4);
+	std::uniform_int_distribution<int> cell(0, 49);
+	std::uniform_int_distribution<int> cost(2, 9);
+	for (int i = 0; i < 600; ++i) {
+		graph->setCost(cell(random), cell(random), cost(random));
+	}
+	std::vector<GridQuery> queries = createRandomQueries(*graph, 150, 4);
+
+	return !graph->hasUniformEdgeWeights() && sameCostsAsQueryRunner(graph, ShortestPathAlgorithm::Dijkstra, 4, queries) &&
+		sameCostsAsQueryRunner(graph, ShortestPathAlgorithm::AStar, 4, queries);
+}
+
+bool test_grid_is_not_modified() {
+	auto graph = createRandomObstacles(40, 40, 20, 5);
+	graph->startNode() = 3;
+	graph->endNode() = 7;
+	uint64_t version = graph->version();
+
+	BatchQueryRunner runner(graph, ShortestPathAlgorithm::AStar, 4);
+	std::vector<GridQueryResult> results = runner.run(createRandomQueries(*graph, 100, 5));
+
+	return results.size() == 100 && graph->startNode() == 3 && graph->endNode() == 7 && graph->version() == version;
+}
+
+bool test_batches_reuse_the_workers() {
+	auto graph = createRandomObstacles(50, 30, 20, 6);
+	std::vector<GridQuery> queries = createRandomQueries(*graph, 120, 6);
+
+	BatchQueryRunner runner(graph, ShortestPathAlgorithm::Dijkstra, 3);
+	std::vector<GridQueryResult> first = runner.run(queries);
+	std::vector<GridQueryResult> empty = runner.run({});
+	std::vector<GridQueryResult> second = runner.run(queries);
+
+	bool same = first.size() == queries.size() && second.size() == queries.size();
+	for (size_t i = 0; i < first.size() && same; ++i) {
+		same = first[i].cost == second[i].cost && first[i].expansions == second[i].expansions;
+	}
+
+	return same && empty.empty() && runner.threads() == 3 && runner.stolenQueries() <= queries.size();
+}
+
+bool test_more_threads_than_queries() {
+	auto graph = createRandomObstacles(30, 30, 20, 7);
+	std::vector<GridQuery> queries = createRandomQueries(*graph, 5, 7);
+
+	return sameCostsAsQueryRunner(graph, ShortestPathAlgorithm::AStar, 16, queries);
+}
+
+std::vector<GridQuery> createRandomQueries(const GridGraph& graph, int count, unsigned int seed) {
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<int> cell(0, graph.numberOfNodes() - 1);
+	auto randomFreeCell = [&](int& x, int& y) {
+		do {
+			graph.coordinates(cell(random), x, y);
+		} while (graph.isBlocked(x, y));
+	};
+
+	std::vector<GridQuery> queries;
+	for (int i = 0; i < count; ++i) {
+		GridQuery query;
+		randomFreeCell(query.startX, query.startY);
+		if (i % 10 == 0) {
+			query.endX = query.startX;
+			query.endY = query.startY;
+		}
+		else {
+			randomFreeCell(query.endX, query.endY);
+		}
+		queries.push_back(query);
+	}
+
+	return queries;
+}
+
+bool sameCostsAsQueryRunner(std::shared_ptr<GridGraph> graph, ShortestPathAlgorithm algorithm, unsigned int threads, const std::vector<GridQuery>& queries) {
+	BatchQueryRunner batch(graph, algorithm, threads);
+	std::vector<GridQueryResult> results = batch.run(queries);
+
+	QueryRunner runner(std::make_shared<GridGraph>(*graph), algorithm);
+	std::vector<GridQueryResult> expected = runner.run(queries);
+
+	bool same = results.size() == expected.size() && batch.threads() == threads;
+	for (size_t i = 0; i < results.size() && same; ++i) {
+		same = results[i].cost == expected[i].cost && (results[i].expansions > 0 || results[i].cost <= 0.0f);
+	}
+
+	return same;
+}
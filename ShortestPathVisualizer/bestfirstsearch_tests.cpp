@@ -0,0 +1,190 @@
+#include "AStar.h"
+#include "BestFirstSearch.h"
+#include "BucketQueue.h"
+#include "DaryHeap.h"
+#include "Dijkstra.h"
+#include "Graph.h"
+#include "GridGraph.h"
+#include "RadixHeap.h"
+#include "SearchContext.h"
+#include "SearchPolicies.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  TYPES  *****************/
+
+// every edge of neighbors() costs 3
+class TripleEdges
+{
+public:
+	template<class Cost, class Graph, class Visit>
+	void expand(const Graph& graph, int node, Visit visit) {
+		for (int neighbor : graph.neighbors(node, _neighborBuffer)) {
+			visit(neighbor, Cost(3));
+		}
+	}
+private:
+	IGraph::NeighborBuffer _neighborBuffer;
+};
+
+/**********  END TYPES  ***************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_grid_astar_expands_like_astar();
+bool test_concrete_graph_expands_like_igraph();
+bool test_integer_costs_match_float_costs();
+bool test_expansion_policy_sets_edge_costs();
+bool test_integer_unreached_distance_is_max();
+bool test_integer_aliases_expand_like_float_searches();
+
+// nodes returned by step() until -1
+template<class Search>
+std::vector<int> expansionOrder(Search& search);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_grid_astar_expands_like_astar, errCount, okCount);
+	TEST(test_concrete_graph_expands_like_igraph, errCount, okCount);
+	TEST(test_integer_costs_match_float_costs, errCount, okCount);
+	TEST(test_expansion_policy_sets_edge_costs, errCount, okCount);
+	TEST(test_integer_unreached_distance_is_max, errCount, okCount);
+	TEST(test_integer_aliases_expand_like_float_searches, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_grid_astar_expands_like_astar() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 25, seed);
+		AStar<BucketQueue> astar(graph, graph->numberOfNodes());
+		GridAStar<BucketQueue> gridAStar(graph, graph->numberOfNodes());
+
+		ok = expansionOrder(astar) == expansionOrder(gridAStar) && astar.parents() == gridAStar.parents();
+	}
+
+	return ok;
+}
+
+bool test_concrete_graph_expands_like_igraph() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGraph(200, 260, seed);
+		graph->startNode() = 0;
+		graph->endNode() = 199;
+
+		Dijkstra<DaryHeap<4>> dijkstra(graph, graph->numberOfNodes());
+		BestFirstSearch<Graph, float, DaryHeap<4>, ZeroHeuristic, UnitEdges> concrete(graph, graph->numberOfNodes());
+
+		ok = expansionOrder(dijkstra) == expansionOrder(concrete) && dijkstra.parents() == concrete.parents();
+	}
+
+	return ok;
+}
+
+bool test_integer_costs_match_float_costs() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 25, seed);
+		SearchResult expected = AStar<BucketQueue>(graph, graph->numberOfNodes()).solve();
+
+		SearchResult wide = BestFirstSearch<GridGraph, uint32_t, RadixHeap, ManhattanHeuristic, UnitEdges>(graph, graph->numberOfNodes()).solve();
+		SearchResult narrow = BestFirstSearch<GridGraph, uint16_t, BucketQueue, ZeroHeuristic, UnitEdges>(graph, graph->numberOfNodes()).solve();
+
+		ok = wide.distance == expected.distance && narrow.distance == expected.distance &&
+			wide.path.size() == expected.path.size() && narrow.path.size() == expected.path.size();
+	}
+
+	return ok;
+}
+
+bool test_expansion_policy_sets_edge_costs() {
+	auto graph = std::make_shared<GridGraph>(10, 10);
+	graph->startNode() = graph->index(1, 1);
+	graph->endNode() = graph->index(8, 5);
+
+	SearchContext<DaryHeap<4>, uint32_t> context(graph->numberOfNodes());
+	BestFirstSearch<GridGraph, uint32_t, DaryHeap<4>, ZeroHeuristic, TripleEdges> search(graph, context);
+	SearchResult result = search.solve();
+
+	return result.distance == 3.0f * 11 && result.path.size() == 12 && context.distance(graph->index(1, 2)) == 3;
+}
+
+bool test_integer_unreached_distance_is_max() {
+	// the end is walled in
+	auto graph = std::make_shared<GridGraph>(5, 5);
+	graph->setBlocked(3, 4, true);
+	graph->setBlocked(4, 3, true);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(4, 4);
+
+	SearchContext<BucketQueue, uint16_t> context(graph->numberOfNodes());
+	BestFirstSearch<GridGraph, uint16_t, BucketQueue, ManhattanHeuristic, UnitEdges> search(graph, context);
+	SearchResult result = search.solve();
+
+	return result.distance < 0.0f && result.path.empty() && context.distance(graph->endNode()) == std::numeric_limits<uint16_t>::max() &&
+		context.distance(graph->index(2, 2)) == 4;
+}
+
+bool test_integer_aliases_expand_like_float_searches() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 25, seed);
+		int capacity = graph->numberOfNodes();
+
+		// same keys in the same order, only their type changes
+		Dijkstra<DaryHeap<4>> dijkstra(graph, capacity);
+		IntegerDijkstra<DaryHeap<4, uint32_t>> integerDijkstra(graph, capacity);
+		AStar<BucketQueue> astar(graph, capacity);
+		IntegerAStar<BucketQueue, uint16_t> integerAStar(graph, capacity);
+		IntegerGridAStar<RadixHeap> integerGridAStar(graph, capacity);
+		AStar<RadixHeap> radixAStar(graph, capacity);
+
+		ok = expansionOrder(dijkstra) == expansionOrder(integerDijkstra) && dijkstra.parents() == integerDijkstra.parents() &&
+			expansionOrder(astar) == expansionOrder(integerAStar) && astar.parents() == integerAStar.parents() &&
+			expansionOrder(radixAStar) == expansionOrder(integerGridAStar) && radixAStar.parents() == integerGridAStar.parents();
+	}
+
+	return ok;
+}
+
+template<class Search>
+std::vector<int> expansionOrder(Search& search) {
+	std::vector<int> expanded;
+	for (int node = search.step(); node != -1; node = search.step()) {
+		expanded.push_back(node);
+	}
+
+	return expanded;
+}
@@ -0,0 +1,180 @@
+#include "BidirectionalSearch.h"
+#include "BucketQueue.h"
+#include "DaryHeap.h"
+#include "Dijkstra.h"
+#include "Graph.h"
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "IShortestPathStrategy.h"
+#include "TestGrids.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_dijkstra_random_grids_match_dijkstra();
+bool test_astar_random_grids_match_dijkstra();
+bool test_random_graphs_match_dijkstra();
+bool test_start_equals_end();
+bool test_unreachable_end();
+bool test_stopping_rules_stop_before_the_queues_are_empty();
+
+// the length of the path found is the one of Dijkstra, parents() and solve() both hold a start -> end path
+// of that length through the meeting node (or there is no path in both)
+template<class Search>
+bool matchesDijkstra(std::shared_ptr<const IGraph> graph);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_dijkstra_random_grids_match_dijkstra, errCount, okCount);
+	TEST(test_astar_random_grids_match_dijkstra, errCount, okCount);
+	TEST(test_random_graphs_match_dijkstra, errCount, okCount);
+	TEST(test_start_equals_end, errCount, okCount);
+	TEST(test_unreachable_end, errCount, okCount);
+	TEST(test_stopping_rules_stop_before_the_queues_are_empty, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_dijkstra_random_grids_match_dijkstra() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 30; ++seed) {
+		auto graph = createRandomGrid(30, 20, 30, seed);
+		ok = ok && matchesDijkstra<BidirectionalDijkstra<>>(graph) && matchesDijkstra<BidirectionalDijkstra<BucketQueue>>(graph);
+	}
+
+	return ok;
+}
+
+bool test_astar_random_grids_match_dijkstra() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 30; ++seed) {
+		auto graph = createRandomGrid(30, 20, 30, seed);
+		ok = ok && matchesDijkstra<BidirectionalAStar<>>(graph) && matchesDijkstra<BidirectionalAStar<BucketQueue>>(graph);
+	}
+
+	return ok;
+}
+
+bool test_random_graphs_match_dijkstra() {
+	// the coordinates of these nodes mean nothing, so only the search without heuristic
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 10; ++seed) {
+		std::shared_ptr<Graph> graph = createRandomGraph(150, 180, seed);
+		graph->startNode() = 0;
+		graph->endNode() = static_cast<int>(seed) * 13;
+		ok = ok && matchesDijkstra<BidirectionalDijkstra<>>(graph);
+	}
+
+	return ok;
+}
+
+bool test_start_equals_end() {
+	auto graph = std::make_shared<GridGraph>(5, 5);
+	graph->startNode() = graph->index(2, 3);
+	graph->endNode() = graph->startNode();
+
+	bool ok = true;
+	for (bool useHeuristic : { false, true }) {
+		std::unique_ptr<BidirectionalSearch<>> search;
+		if (useHeuristic) {
+			search.reset(new BidirectionalAStar<>(graph, graph->numberOfNodes()));
+		}
+		else {
+			search.reset(new BidirectionalDijkstra<>(graph, graph->numberOfNodes()));
+		}
+
+		SearchResult result = search->solve();
+		ok = ok && search->pathWeight() == 0.0f && search->meetingNode() == graph->startNode() &&
+			result.distance == 0.0f && result.path == std::vector<int>{ graph->startNode() };
+	}
+
+	return ok;
+}
+
+bool test_unreachable_end() {
+	// the end is closed in by blocked cells
+	auto graph = std::make_shared<GridGraph>(9, 9);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(6, 6);
+	for (int i = 5; i <= 7; ++i) {
+		graph->setBlocked(i, 5, true);
+		graph->setBlocked(i, 7, true);
+		graph->setBlocked(5, i, true);
+		graph->setBlocked(7, i, true);
+	}
+
+	BidirectionalDijkstra<> dijkstra(graph, graph->numberOfNodes());
+	SearchResult dijkstraResult = dijkstra.solve();
+	BidirectionalAStar<> astar(graph, graph->numberOfNodes());
+	SearchResult astarResult = astar.solve();
+
+	return matchesDijkstra<BidirectionalDijkstra<>>(graph) &&
+		dijkstraResult.distance < 0.0f && dijkstraResult.path.empty() && dijkstra.meetingNode() == -1 && dijkstra.pathWeight() < 0.0f &&
+		astarResult.distance < 0.0f && astarResult.path.empty() && astar.meetingNode() == -1 && astar.pathWeight() < 0.0f;
+}
+
+bool test_stopping_rules_stop_before_the_queues_are_empty() {
+	// on an open grid both searches stop once the best path can't be improved, long before every cell
+	// was expanded; the A* rule (either top reaches the best path) stops earlier than the Dijkstra one
+	auto graph = std::make_shared<GridGraph>(41, 41);
+	graph->startNode() = graph->index(5, 20);
+	graph->endNode() = graph->index(35, 20);
+
+	BidirectionalDijkstra<> dijkstra(graph, graph->numberOfNodes());
+	int dijkstraExpanded = expandAll(dijkstra);
+	BidirectionalAStar<> astar(graph, graph->numberOfNodes());
+	int astarExpanded = expandAll(astar);
+
+	return dijkstra.pathWeight() == 30.0f && astar.pathWeight() == 30.0f && isPathOfGraph(*graph, dijkstra, 30) && isPathOfGraph(*graph, astar, 30) &&
+		dijkstraExpanded < graph->numberOfNodes() / 2 && astarExpanded < dijkstraExpanded;
+}
+
+template<class Search>
+bool matchesDijkstra(std::shared_ptr<const IGraph> graph) {
+	Dijkstra<> dijkstra(graph, graph->numberOfNodes());
+	float expected = dijkstra.solve().distance;
+
+	Search stepped(graph, graph->numberOfNodes());
+	expandAll(stepped);
+	Search solved(graph, graph->numberOfNodes());
+	SearchResult result = solved.solve();
+
+	if (expected < 0.0f) {
+		return stepped.pathWeight() < 0.0f && stepped.meetingNode() == -1 && result.distance < 0.0f && result.path.empty();
+	}
+
+	int length = static_cast<int>(expected);
+	bool throughMeetingNode = std::find(result.path.begin(), result.path.end(), solved.meetingNode()) != result.path.end();
+
+	return stepped.pathWeight() == expected && result.distance == expected && result.path.size() == static_cast<size_t>(length) + 1 &&
+		stepped.parents() == solved.parents() && isPathOfGraph(*graph, stepped, length) && throughMeetingNode;
+}
@@ -0,0 +1,177 @@
+#include "BitboardBreadthFirstSearch.h"
+#include "GridGraph.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_open_grid_distances_are_manhattan();
+bool test_blocked_start_reaches_nothing();
+bool test_wall_with_gap_goes_around();
+bool test_random_grids_match_breadth_first_search();
+bool test_stop_node_stops_at_its_layer();
+bool test_path_goes_from_start_to_node();
+
+// random obstacles, the start (and end) on the middle cell
+std::shared_ptr<GridGraph> createCenteredGrid(int width, int height, int obstaclePercent, unsigned int seed);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_open_grid_distances_are_manhattan, errCount, okCount);
+	TEST(test_blocked_start_reaches_nothing, errCount, okCount);
+	TEST(test_wall_with_gap_goes_around, errCount, okCount);
+	TEST(test_random_grids_match_breadth_first_search, errCount, okCount);
+	TEST(test_stop_node_stops_at_its_layer, errCount, okCount);
+	TEST(test_path_goes_from_start_to_node, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_open_grid_distances_are_manhattan() {
+	// width crosses a word boundary
+	auto graph = std::make_shared<GridGraph>(70, 5);
+	graph->startNode() = graph->index(63, 2);
+
+	BitboardBreadthFirstSearch search(graph);
+	search.run();
+
+	bool ok = true;
+	for (int y = 0; y < 5; ++y) {
+		for (int x = 0; x < 70; ++x) {
+			uint32_t expected = std::abs(x - 63) + std::abs(y - 2);
+			ok = ok && search.distance(graph->index(x, y)) == expected;
+		}
+	}
+
+	return ok && search.numberOfLayers() == 63 + 2 + 1;
+}
+
+bool test_blocked_start_reaches_nothing() {
+	auto graph = std::make_shared<GridGraph>(4, 4);
+	graph->setBlocked(0, 0, true);
+	graph->startNode() = graph->index(0, 0);
+
+	BitboardBreadthFirstSearch search(graph);
+	search.run();
+
+	bool ok = search.numberOfLayers() == 0;
+	for (int node = 0; node < graph->numberOfNodes(); ++node) {
+		ok = ok && search.distance(node) == BitboardBreadthFirstSearch::unreachable;
+	}
+
+	return ok;
+}
+
+bool test_wall_with_gap_goes_around() {
+	// vertical wall on x = 2 with a gap on the last row
+	auto graph = std::make_shared<GridGraph>(5, 4);
+	for (int y = 0; y < 3; ++y) {
+		graph->setBlocked(2, y, true);
+	}
+	graph->startNode() = graph->index(0, 0);
+
+	BitboardBreadthFirstSearch search(graph);
+	search.run();
+
+	return search.distance(graph->index(4, 0)) == 10 &&
+		search.distance(graph->index(2, 3)) == 5 &&
+		search.distance(graph->index(2, 0)) == BitboardBreadthFirstSearch::unreachable;
+}
+
+bool test_random_grids_match_breadth_first_search() {
+	bool ok = true;
+	unsigned int seed = 1;
+	for (int width : { 1, 30, 64, 65, 130, 257 }) {
+		for (int obstaclePercent : { 0, 25, 40 }) {
+			auto graph = createCenteredGrid(width, 37, obstaclePercent, seed++);
+
+			BitboardBreadthFirstSearch search(graph);
+			search.run();
+
+			// -1 (not reachable) converts to BitboardBreadthFirstSearch::unreachable, 0xFFFFFFFF
+			std::vector<int> reference = referenceDistances(*graph, graph->startNode());
+			std::vector<uint32_t> distances(reference.begin(), reference.end());
+			ok = ok && search.distances() == distances;
+		}
+	}
+
+	return ok;
+}
+
+bool test_stop_node_stops_at_its_layer() {
+	auto graph = std::make_shared<GridGraph>(100, 100);
+	graph->startNode() = graph->index(0, 0);
+
+	BitboardBreadthFirstSearch search(graph);
+	search.run(graph->index(3, 4));
+
+	// layer 7 is complete, nothing further than that was reached
+	return search.distance(graph->index(3, 4)) == 7 &&
+		search.distance(graph->index(7, 0)) == 7 &&
+		search.distance(graph->index(8, 0)) == BitboardBreadthFirstSearch::unreachable &&
+		search.numberOfLayers() == 8;
+}
+
+bool test_path_goes_from_start_to_node() {
+	auto graph = createCenteredGrid(90, 40, 25, 99);
+	BitboardBreadthFirstSearch search(graph);
+	search.run();
+
+	std::vector<int> parents = search.parents();
+	bool ok = true;
+	for (int node = 0; node < graph->numberOfNodes(); ++node) {
+		std::vector<int> path = search.path(node);
+		if (search.distance(node) == BitboardBreadthFirstSearch::unreachable) {
+			ok = ok && path.empty() && parents[node] == -1;
+			continue;
+		}
+
+		ok = ok && path.size() == search.distance(node) + 1 &&
+			path.front() == graph->startNode() &&
+			path.back() == node;
+		for (size_t i = 1; i < path.size(); ++i) {
+			ok = ok && parents[path[i]] == path[i - 1];
+		}
+	}
+
+	return ok;
+}
+
+std::shared_ptr<GridGraph> createCenteredGrid(int width, int height, int obstaclePercent, unsigned int seed) {
+	std::shared_ptr<GridGraph> graph = createRandomObstacles(width, height, obstaclePercent, seed);
+	graph->setBlocked(width / 2, height / 2, false);
+	graph->startNode() = graph->index(width / 2, height / 2);
+	graph->endNode() = graph->startNode();
+
+	return graph;
+}
@@ -0,0 +1,213 @@
+#include "AStar.h"
+#include "BreadthFirstSearch.h"
+#include "BucketQueue.h"
+#include "Dijkstra.h"
+#include "Graph.h"
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "IShortestPathStrategy.h"
+#include "RadixHeap.h"
+#include "ShortestPathStrategyFactory.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_random_grids_match_dijkstra();
+bool test_random_graphs_match_dijkstra();
+bool test_ring_buffer_wraps_at_full_capacity();
+bool test_start_equals_end_and_unreachable_end();
+bool test_factory_picks_by_edge_weights();
+
+// every node BreadthFirstSearch reaches from the start of graph (with no end to stop at) is reached by Dijkstra
+// with the same distance, and its parent is a neighbor one step closer
+bool sameDistancesAsDijkstra(std::shared_ptr<const IGraph> graph);
+// number of parents from node back to start, -1 if the chain doesn't get there
+int parentDistance(const std::vector<int>& parents, int start, int node);
+template<class Strategy>
+bool isA(const std::unique_ptr<IShortestPathStrategy>& strategy);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 5;
+
+	TEST(test_random_grids_match_dijkstra, errCount, okCount);
+	TEST(test_random_graphs_match_dijkstra, errCount, okCount);
+	TEST(test_ring_buffer_wraps_at_full_capacity, errCount, okCount);
+	TEST(test_start_equals_end_and_unreachable_end, errCount, okCount);
+	TEST(test_factory_picks_by_edge_weights, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_random_grids_match_dijkstra() {
+	bool ok = true;
+	unsigned int seed = 1;
+	for (int width : { 1, 13, 64, 70 }) {
+		for (int obstaclePercent : { 0, 20, 35 }) {
+			auto graph = createRandomGrid(width, 23, obstaclePercent, seed++);
+			graph->endNode() = -1;
+			ok = ok && sameDistancesAsDijkstra(graph);
+		}
+	}
+
+	return ok;
+}
+
+bool test_random_graphs_match_dijkstra() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 5; ++seed) {
+		std::shared_ptr<Graph> graph = createRandomGraph(200, 260, seed);
+		graph->startNode() = static_cast<int>(seed);
+		graph->endNode() = -1;
+		ok = ok && sameDistancesAsDijkstra(graph);
+	}
+
+	return ok;
+}
+
+bool test_ring_buffer_wraps_at_full_capacity() {
+	// the queue has exactly one slot per node: with nothing to stop at every node is pushed once,
+	// the last one into the last slot, and popping it takes the head back to slot 0
+	bool ok = true;
+	for (int width : { 1, 2, 9, 64 }) {
+		auto graph = std::make_shared<GridGraph>(width, 7);
+		graph->startNode() = graph->numberOfNodes() / 2;
+		graph->endNode() = -1;
+
+		BreadthFirstSearch search(graph, graph->numberOfNodes());
+		std::vector<bool> expanded(graph->numberOfNodes(), false);
+		int previousDistance = 0;
+		int count = 0;
+		for (int node = search.step(); node != -1; node = search.step()) {
+			int distance = parentDistance(search.parents(), graph->startNode(), node);
+			// FIFO order: distances never go down, and no node comes out twice
+			ok = ok && !expanded[node] && distance >= previousDistance;
+			expanded[node] = true;
+			previousDistance = distance;
+			++count;
+		}
+
+		ok = ok && count == graph->numberOfNodes() && search.step() == -1;
+	}
+
+	// a single node fills the whole queue at once
+	auto single = std::make_shared<GridGraph>(1, 1);
+	single->endNode() = -1;
+	BreadthFirstSearch search(single, 1);
+
+	return ok && search.step() == 0 && search.step() == -1;
+}
+
+bool test_start_equals_end_and_unreachable_end() {
+	auto graph = std::make_shared<GridGraph>(6, 4);
+	graph->startNode() = graph->index(2, 1);
+	graph->endNode() = graph->startNode();
+	SearchResult same = BreadthFirstSearch(graph, graph->numberOfNodes()).solve();
+
+	// column 3 walls off the right side
+	for (int y = 0; y < 4; ++y) {
+		graph->setBlocked(3, y, true);
+	}
+	graph->endNode() = graph->index(5, 2);
+	SearchResult walled = BreadthFirstSearch(graph, graph->numberOfNodes()).solve();
+
+	graph->endNode() = graph->index(0, 3);
+	SearchResult reached = BreadthFirstSearch(graph, graph->numberOfNodes()).solve();
+
+	return same.distance == 0.0f && same.path == std::vector<int>{ graph->startNode() } &&
+		walled.distance < 0.0f && walled.path.empty() &&
+		reached.distance == 4.0f && reached.path.size() == 5 && reached.path.front() == graph->startNode() && reached.path.back() == graph->endNode();
+}
+
+bool test_factory_picks_by_edge_weights() {
+	auto grid = std::make_shared<GridGraph>(8, 8);
+	std::shared_ptr<Graph> graph = createRandomGraph(20, 30, 1);
+	size_t capacity = 64;
+
+	bool ok = isA<BreadthFirstSearch>(ShortestPathStrategyFactory::create(ShortestPathAlgorithm::Dijkstra, grid, capacity)) &&
+		isA<IntegerGridAStar<BucketQueue>>(ShortestPathStrategyFactory::create(ShortestPathAlgorithm::AStar, grid, capacity)) &&
+		isA<BreadthFirstSearch>(ShortestPathStrategyFactory::create(ShortestPathAlgorithm::Dijkstra, graph, capacity)) &&
+		isA<IntegerAStar<BucketQueue>>(ShortestPathStrategyFactory::create(ShortestPathAlgorithm::AStar, graph, capacity));
+
+	// a terrain cost makes the grid weighted, and setting it back to 1 makes it uniform again
+	grid->setCost(3, 3, 5);
+	ok = ok && isA<WeightedDijkstra<RadixHeap>>(ShortestPathStrategyFactory::create(ShortestPathAlgorithm::Dijkstra, grid, capacity)) &&
+		isA<WeightedAStar<RadixHeap>>(ShortestPathStrategyFactory::create(ShortestPathAlgorithm::AStar, grid, capacity));
+	grid->setCost(3, 3, 1);
+
+	return ok && isA<BreadthFirstSearch>(ShortestPathStrategyFactory::create(ShortestPathAlgorithm::Dijkstra, grid, capacity));
+}
+
+bool sameDistancesAsDijkstra(std::shared_ptr<const IGraph> graph) {
+	BreadthFirstSearch search(graph, graph->numberOfNodes());
+	expandAll(search);
+
+	Dijkstra<>::Context context(graph->numberOfNodes());
+	Dijkstra<> dijkstra(graph, context);
+	expandAll(dijkstra);
+
+	IGraph::NeighborBuffer buffer;
+	int start = graph->startNode();
+	bool ok = search.parents()[start] == -1;
+	for (int node = 0; node < graph->numberOfNodes(); ++node) {
+		int distance = parentDistance(search.parents(), start, node);
+		if (!context.isReached(node)) {
+			ok = ok && distance == -1;
+			continue;
+		}
+
+		ok = ok && distance == static_cast<int>(context.distance(node));
+		if (node != start) {
+			int parent = search.parents()[node];
+			bool adjacent = false;
+			for (int neighbor : graph->neighbors(parent, buffer)) {
+				adjacent = adjacent || neighbor == node;
+			}
+			ok = ok && adjacent && parentDistance(search.parents(), start, parent) == distance - 1;
+		}
+	}
+
+	return ok;
+}
+
+int parentDistance(const std::vector<int>& parents, int start, int node) {
+	int distance = 0;
+	while (node != start && node >= 0) {
+		node = parents[node];
+		++distance;
+	}
+
+	return node == start ? distance : -1;
+}
+
+template<class Strategy>
+bool isA(const std::unique_ptr<IShortestPathStrategy>& strategy) {
+	return dynamic_cast<const Strategy*>(strategy.get()) != nullptr;
+}
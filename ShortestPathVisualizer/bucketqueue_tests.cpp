@@ -0,0 +1,208 @@
+#include "BucketQueue.h"
+#include "RadixHeap.h"
+
+#include <assert.h>
+#include <iostream>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_bucket_queue_empty();
+bool test_bucket_queue_insert_pop_size();
+bool test_bucket_queue_top_smallest();
+bool test_bucket_queue_decrease_key_makes_it_smallest();
+bool test_bucket_queue_keys_wrap_around_buckets();
+bool test_bucket_queue_new_window_after_empty();
+bool test_radix_heap_empty();
+bool test_radix_heap_insert_pop_size();
+bool test_radix_heap_pops_in_order();
+bool test_radix_heap_decrease_key_makes_it_smallest();
+bool test_radix_heap_decrease_key_does_not_pop_twice();
+bool test_integer_keys_match_float_keys();
+
+template<class Queue>
+bool popsInOrder(Queue& queue, const std::vector<int>& expectedNodes, const std::vector<float>& expectedKeys);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 12;
+
+	TEST(test_bucket_queue_empty, errCount, okCount);
+	TEST(test_bucket_queue_insert_pop_size, errCount, okCount);
+	TEST(test_bucket_queue_top_smallest, errCount, okCount);
+	TEST(test_bucket_queue_decrease_key_makes_it_smallest, errCount, okCount);
+	TEST(test_bucket_queue_keys_wrap_around_buckets, errCount, okCount);
+	TEST(test_bucket_queue_new_window_after_empty, errCount, okCount);
+	TEST(test_radix_heap_empty, errCount, okCount);
+	TEST(test_radix_heap_insert_pop_size, errCount, okCount);
+	TEST(test_radix_heap_pops_in_order, errCount, okCount);
+	TEST(test_radix_heap_decrease_key_makes_it_smallest, errCount, okCount);
+	TEST(test_radix_heap_decrease_key_does_not_pop_twice, errCount, okCount);
+	TEST(test_integer_keys_match_float_keys, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+template<class Queue>
+bool popsInOrder(Queue& queue, const std::vector<int>& expectedNodes, const std::vector<float>& expectedKeys) {
+	for (size_t i = 0; i < expectedNodes.size(); ++i) {
+		if (queue.isEmpty() || queue.top() != expectedNodes[i] || queue.topKey() != expectedKeys[i]) {
+			return false;
+		}
+		queue.pop();
+	}
+
+	return queue.isEmpty();
+}
+
+bool test_bucket_queue_empty() {
+	BucketQueue queue(3);
+	return queue.isEmpty() && queue.size() == 0;
+}
+
+bool test_bucket_queue_insert_pop_size() {
+	BucketQueue queue(3);
+	queue.insert(0, 2.0f);
+	bool ok = !queue.isEmpty() && queue.size() == 1;
+
+	queue.pop();
+	return ok && queue.isEmpty() && queue.size() == 0;
+}
+
+bool test_bucket_queue_top_smallest() {
+	BucketQueue queue(3);
+	queue.insert(0, 3.0f);
+	queue.insert(1, 1.0f);
+	queue.insert(2, 2.0f);
+
+	return popsInOrder(queue, { 1, 2, 0 }, { 1.0f, 2.0f, 3.0f });
+}
+
+bool test_bucket_queue_decrease_key_makes_it_smallest() {
+	BucketQueue queue(3);
+	queue.insert(0, 2.0f);
+	queue.insert(1, 3.0f);
+	queue.insert(2, 4.0f);
+
+	queue.decreaseKey(2, 1.0f);
+
+	return popsInOrder(queue, { 2, 0, 1 }, { 1.0f, 2.0f, 3.0f });
+}
+
+bool test_bucket_queue_keys_wrap_around_buckets() {
+	// 4 buckets, keys go well past the number of buckets
+	BucketQueue queue(4, 3);
+	bool ok = queue.numberOfBuckets() == 4;
+
+	queue.insert(0, 0.0f);
+	for (int node = 1; node < 4; ++node) {
+		int popped = queue.top();
+		float key = queue.topKey();
+		queue.pop();
+		ok = ok && popped == node - 1 && key == 3.0f * (node - 1);
+
+		queue.insert(node, key + 3.0f);
+	}
+
+	return ok && popsInOrder(queue, { 3 }, { 9.0f });
+}
+
+bool test_bucket_queue_new_window_after_empty() {
+	BucketQueue queue(2, 3);
+	queue.insert(0, 1.0f);
+	queue.pop();
+
+	// far from the last popped key, but the queue is empty
+	queue.insert(1, 20.0f);
+
+	return popsInOrder(queue, { 1 }, { 20.0f });
+}
+
+bool test_radix_heap_empty() {
+	RadixHeap heap(3);
+	return heap.isEmpty() && heap.size() == 0;
+}
+
+bool test_radix_heap_insert_pop_size() {
+	RadixHeap heap(3);
+	heap.insert(0, 2.0f);
+	bool ok = !heap.isEmpty() && heap.size() == 1;
+
+	heap.pop();
+	return ok && heap.isEmpty() && heap.size() == 0;
+}
+
+bool test_radix_heap_pops_in_order() {
+	RadixHeap heap(5);
+	heap.insert(0, 40.0f);
+	heap.insert(1, 7.0f);
+	heap.insert(2, 1000.0f);
+	heap.insert(3, 8.0f);
+	heap.insert(4, 7.0f);
+
+	bool ok = heap.topKey() == 7.0f;
+	heap.pop();
+	heap.pop();
+
+	return ok && popsInOrder(heap, { 3, 0, 2 }, { 8.0f, 40.0f, 1000.0f });
+}
+
+bool test_radix_heap_decrease_key_makes_it_smallest() {
+	RadixHeap heap(3);
+	heap.insert(0, 5.0f);
+	heap.insert(1, 6.0f);
+	heap.insert(2, 9.0f);
+
+	heap.decreaseKey(2, 4.0f);
+
+	return popsInOrder(heap, { 2, 0, 1 }, { 4.0f, 5.0f, 6.0f });
+}
+
+bool test_radix_heap_decrease_key_does_not_pop_twice() {
+	RadixHeap heap(2);
+	heap.insert(0, 5.0f);
+	heap.insert(1, 9.0f);
+	heap.decreaseKey(1, 8.0f);
+	heap.decreaseKey(1, 6.0f);
+
+	// stale entries of node 1 must be discarded
+	return heap.size() == 2 && popsInOrder(heap, { 0, 1 }, { 5.0f, 6.0f });
+}
+
+bool test_integer_keys_match_float_keys() {
+	BucketQueue queue(3);
+	queue.insert(0, 3u);
+	queue.insert(1, 5.0f);
+	queue.insert(2, 6u);
+	queue.decreaseKey(2, 2u);
+
+	RadixHeap heap(3);
+	heap.insert(0, 40u);
+	heap.insert(1, 7.0f);
+	heap.insert(2, 1000u);
+	heap.decreaseKey(2, 9u);
+
+	return popsInOrder(queue, { 2, 0, 1 }, { 2.0f, 3.0f, 5.0f }) && popsInOrder(heap, { 1, 2, 0 }, { 7.0f, 9.0f, 40.0f });
+}
@@ -0,0 +1,172 @@
+#include "ContractionHierarchy.h"
+#include "ContractionHierarchyQuery.h"
+#include "Graph.h"
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_ranks_are_a_permutation();
+bool test_shortcuts_are_added_on_grids();
+bool test_grid_paths_match_breadth_first_search();
+bool test_graph_paths_match_breadth_first_search();
+bool test_start_equals_end();
+bool test_unreachable_end();
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_ranks_are_a_permutation, errCount, okCount);
+	TEST(test_shortcuts_are_added_on_grids, errCount, okCount);
+	TEST(test_grid_paths_match_breadth_first_search, errCount, okCount);
+	TEST(test_graph_paths_match_breadth_first_search, errCount, okCount);
+	TEST(test_start_equals_end, errCount, okCount);
+	TEST(test_unreachable_end, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_ranks_are_a_permutation() {
+	auto graph = createRandomGrid(20, 15, 25, 1);
+	ContractionHierarchy hierarchy(graph);
+
+	std::vector<bool> used(graph->numberOfNodes(), false);
+	bool ok = hierarchy.numberOfNodes() == graph->numberOfNodes();
+	for (int node = 0; ok && node < hierarchy.numberOfNodes(); ++node) {
+		int rank = hierarchy.rank(node);
+		ok = rank >= 0 && rank < hierarchy.numberOfNodes() && !used[rank];
+		used[rank] = true;
+
+		// upward edges only go up
+		for (const ContractionHierarchy::Edge& edge : hierarchy.upward(node)) {
+			ok = ok && hierarchy.rank(edge.target) > rank && edge.weight > 0;
+		}
+	}
+
+	return ok;
+}
+
+bool test_shortcuts_are_added_on_grids() {
+	auto graph = std::make_shared<GridGraph>(16, 16);
+	ContractionHierarchy hierarchy(graph);
+
+	size_t shortcuts = 0;
+	for (int node = 0; node < hierarchy.numberOfNodes(); ++node) {
+		for (const ContractionHierarchy::Edge& edge : hierarchy.upward(node)) {
+			shortcuts += edge.middle >= 0 ? 1 : 0;
+		}
+	}
+
+	return hierarchy.numberOfShortcuts() > 0 &&
+		shortcuts <= hierarchy.numberOfShortcuts() &&
+		hierarchy.numberOfUpwardEdges() >= shortcuts &&
+		hierarchy.buildMilliseconds() >= 0.0;
+}
+
+bool test_grid_paths_match_breadth_first_search() {
+	bool ok = true;
+	for (int obstaclePercent : { 0, 20, 35 }) {
+		auto graph = createRandomGrid(40, 30, obstaclePercent, obstaclePercent + 7);
+		auto hierarchy = std::make_shared<ContractionHierarchy>(graph);
+
+		std::vector<int> freeCells;
+		for (int node = 0; node < graph->numberOfNodes(); ++node) {
+			if (!graph->isBlocked(node % 40, node / 40)) {
+				freeCells.push_back(node);
+			}
+		}
+
+		std::mt19937 random(obstaclePercent);
+		std::uniform_int_distribution<size_t> cell(0, freeCells.size() - 1);
+		for (int query = 0; query < 30; ++query) {
+			graph->startNode() = freeCells[cell(random)];
+			graph->endNode() = freeCells[cell(random)];
+
+			ContractionHierarchyQuery search(graph, hierarchy, graph->numberOfNodes());
+			expandAll(search);
+
+			int expected = referenceDistance(graph);
+			ok = ok && search.pathWeight() == expected && (expected < 0 || isPathOfGraph(*graph, search, expected));
+		}
+	}
+
+	return ok;
+}
+
+bool test_graph_paths_match_breadth_first_search() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 5; ++seed) {
+		auto graph = createRandomGraph(300, 450, seed);
+		auto hierarchy = std::make_shared<ContractionHierarchy>(graph);
+
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<int> node(0, graph->numberOfNodes() - 1);
+		for (int query = 0; query < 30; ++query) {
+			graph->startNode() = node(random);
+			graph->endNode() = node(random);
+
+			ContractionHierarchyQuery search(graph, hierarchy, graph->numberOfNodes());
+			expandAll(search);
+
+			int expected = referenceDistance(graph);
+			ok = ok && search.pathWeight() == expected && (expected < 0 || isPathOfGraph(*graph, search, expected));
+		}
+	}
+
+	return ok;
+}
+
+bool test_start_equals_end() {
+	auto graph = createRandomGrid(10, 10, 0, 1);
+	graph->endNode() = graph->startNode();
+
+	ContractionHierarchyQuery search(graph, std::make_shared<ContractionHierarchy>(graph), graph->numberOfNodes());
+	expandAll(search);
+
+	return search.pathWeight() == 0 && search.parents()[graph->endNode()] == -1;
+}
+
+bool test_unreachable_end() {
+	// the right column is cut off by a wall
+	auto graph = std::make_shared<GridGraph>(10, 5);
+	for (int y = 0; y < 5; ++y) {
+		graph->setBlocked(8, y, true);
+	}
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(9, 4);
+
+	ContractionHierarchyQuery search(graph, std::make_shared<ContractionHierarchy>(graph), graph->numberOfNodes());
+	expandAll(search);
+
+	return search.pathWeight() < 0 && search.parents()[graph->endNode()] == -1;
+}
@@ -0,0 +1,221 @@
+#include "DaryHeap.h"
+
+#include <assert.h>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_empty_heap_capacity_three();
+bool test_insert_pop_size_and_contains();
+bool test_top_smallest();
+bool test_decrease_key_makes_it_smallest();
+bool test_pop_after_decrease_key_preserves_positions();
+bool test_random_sequence_pops_sorted_binary();
+bool test_random_sequence_pops_sorted_4_ary();
+bool test_random_sequence_pops_sorted_8_ary();
+bool test_update_key_up_and_down();
+bool test_remove_from_the_middle();
+bool test_pair_keys_are_lexicographic();
+
+template<int Arity>
+bool randomSequencePopsSorted();
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 11;
+
+	TEST(test_empty_heap_capacity_three, errCount, okCount);
+	TEST(test_insert_pop_size_and_contains, errCount, okCount);
+	TEST(test_top_smallest, errCount, okCount);
+	TEST(test_decrease_key_makes_it_smallest, errCount, okCount);
+	TEST(test_pop_after_decrease_key_preserves_positions, errCount, okCount);
+	TEST(test_random_sequence_pops_sorted_binary, errCount, okCount);
+	TEST(test_random_sequence_pops_sorted_4_ary, errCount, okCount);
+	TEST(test_random_sequence_pops_sorted_8_ary, errCount, okCount);
+	TEST(test_update_key_up_and_down, errCount, okCount);
+	TEST(test_remove_from_the_middle, errCount, okCount);
+	TEST(test_pair_keys_are_lexicographic, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_empty_heap_capacity_three() {
+	DaryHeap<4> heap(3);
+	return heap.isEmpty() && heap.size() == 0 && heap.capacity() == 3 &&
+		!heap.contains(0) && !heap.contains(1) && !heap.contains(2);
+}
+
+bool test_insert_pop_size_and_contains() {
+	DaryHeap<4> heap(3);
+	heap.insert(1, 2.0f);
+	bool ok = heap.size() == 1 && heap.contains(1) && !heap.contains(0) && heap.key(1) == 2.0f;
+
+	heap.pop();
+	return ok && heap.isEmpty() && !heap.contains(1);
+}
+
+bool test_top_smallest() {
+	DaryHeap<2> heap(3);
+	heap.insert(0, 3.0f);
+	heap.insert(1, 1.0f);
+	heap.insert(2, 2.0f);
+
+	return heap.top() == 1 && heap.topKey() == 1.0f;
+}
+
+bool test_decrease_key_makes_it_smallest() {
+	DaryHeap<2> heap(4);
+	heap.insert(0, 1.0f);
+	heap.insert(1, 2.0f);
+	heap.insert(2, 3.0f);
+	heap.insert(3, 4.0f);
+
+	heap.decreaseKey(3, 0.5f);
+
+	return heap.top() == 3 && heap.topKey() == 0.5f && heap.key(0) == 1.0f;
+}
+
+bool test_pop_after_decrease_key_preserves_positions() {
+	DaryHeap<4> heap(6);
+	for (int node = 0; node < 6; ++node) {
+		heap.insert(node, 10.0f + node);
+	}
+
+	heap.decreaseKey(5, 1.0f);
+	heap.decreaseKey(4, 2.0f);
+	heap.pop();
+
+	// keys can still be found through the positions after the pop
+	bool ok = heap.top() == 4 && !heap.contains(5);
+	for (int node = 0; node < 4; ++node) {
+		ok = ok && heap.contains(node) && heap.key(node) == 10.0f + node;
+	}
+
+	return ok;
+}
+
+bool test_random_sequence_pops_sorted_binary() {
+	return randomSequencePopsSorted<2>();
+}
+
+bool test_random_sequence_pops_sorted_4_ary() {
+	return randomSequencePopsSorted<4>();
+}
+
+bool test_random_sequence_pops_sorted_8_ary() {
+	return randomSequencePopsSorted<8>();
+}
+
+bool test_update_key_up_and_down() {
+	DaryHeap<2> heap(4);
+	for (int node = 0; node < 4; ++node) {
+		heap.insert(node, 1.0f + node);
+	}
+
+	heap.updateKey(0, 10.0f);
+	bool ok = heap.top() == 1 && heap.key(0) == 10.0f;
+	heap.updateKey(3, 0.5f);
+	ok = ok && heap.top() == 3;
+
+	std::vector<int> order;
+	while (!heap.isEmpty()) {
+		order.push_back(heap.top());
+		heap.pop();
+	}
+
+	return ok && order == std::vector<int>{ 3, 1, 2, 0 };
+}
+
+bool test_remove_from_the_middle() {
+	const int numberOfNodes = 200;
+	std::mt19937 random(7);
+	std::uniform_int_distribution<int> keys(0, 1000);
+
+	DaryHeap<4> heap(numberOfNodes);
+	for (int node = 0; node < numberOfNodes; ++node) {
+		heap.insert(node, static_cast<float>(keys(random)));
+	}
+	for (int node = 0; node < numberOfNodes; node += 4) {
+		heap.remove(node);
+	}
+
+	float last = -1.0f;
+	bool ok = heap.size() == numberOfNodes - numberOfNodes / 4;
+	while (!heap.isEmpty()) {
+		ok = ok && heap.top() % 4 != 0 && heap.topKey() >= last;
+		last = heap.topKey();
+		heap.pop();
+	}
+
+	return ok;
+}
+
+bool test_pair_keys_are_lexicographic() {
+	DaryHeap<4, std::pair<int, int>> heap(3);
+	heap.insert(0, std::make_pair(5, 2));
+	heap.insert(1, std::make_pair(5, 1));
+	heap.insert(2, std::make_pair(6, 0));
+
+	bool ok = heap.top() == 1;
+	heap.updateKey(1, std::make_pair(5, 3));
+	ok = ok && heap.top() == 0;
+	heap.pop();
+	heap.pop();
+
+	return ok && heap.top() == 2 && heap.topKey() == std::make_pair(6, 0);
+}
+
+template<int Arity>
+bool randomSequencePopsSorted() {
+	const int numberOfNodes = 500;
+	std::mt19937 random(Arity);
+	std::uniform_int_distribution<int> keys(0, 1000);
+
+	DaryHeap<Arity> heap(numberOfNodes);
+	std::vector<float> expected(numberOfNodes);
+	for (int node = 0; node < numberOfNodes; ++node) {
+		expected[node] = static_cast<float>(keys(random));
+		heap.insert(node, expected[node]);
+	}
+	for (int node = 0; node < numberOfNodes; node += 3) {
+		expected[node] /= 2.0f;
+		heap.decreaseKey(node, expected[node]);
+	}
+
+	float last = -1.0f;
+	int popped = 0;
+	bool ok = true;
+	while (!heap.isEmpty()) {
+		ok = ok && heap.topKey() >= last && heap.topKey() == expected[heap.top()];
+		last = heap.topKey();
+		heap.pop();
+		++popped;
+	}
+
+	return ok && popped == numberOfNodes;
+}
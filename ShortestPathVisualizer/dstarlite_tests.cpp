@@ -0,0 +1,257 @@
+#include "DStarLite.h"
+#include "Dijkstra.h"
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_first_search_finds_shortest_paths();
+bool test_blocking_tiles_repairs_the_path();
+bool test_clearing_tiles_repairs_the_path();
+bool test_replanning_near_the_start_is_cheaper_than_searching_again();
+bool test_walled_off_end_and_reopened();
+bool test_moving_start_keeps_the_search();
+bool test_terrain_costs_match_weighted_dijkstra();
+
+// true if the search path is a shortest one of graph (or there is none in both)
+bool matchesReference(std::shared_ptr<GridGraph> graph, const DStarLite& search);
+// the same with the tile costs: the weight is the one of WeightedDijkstra and the parents add up to it
+bool matchesWeightedReference(std::shared_ptr<GridGraph> graph, const DStarLite& search);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 7;
+
+	TEST(test_first_search_finds_shortest_paths, errCount, okCount);
+	TEST(test_blocking_tiles_repairs_the_path, errCount, okCount);
+	TEST(test_clearing_tiles_repairs_the_path, errCount, okCount);
+	TEST(test_replanning_near_the_start_is_cheaper_than_searching_again, errCount, okCount);
+	TEST(test_walled_off_end_and_reopened, errCount, okCount);
+	TEST(test_moving_start_keeps_the_search, errCount, okCount);
+	TEST(test_terrain_costs_match_weighted_dijkstra, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_first_search_finds_shortest_paths() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 30; ++seed) {
+		auto graph = createRandomGrid(40, 30, seed % 4 * 10, seed);
+		DStarLite search(graph, graph->numberOfNodes());
+		expandAll(search);
+
+		ok = ok && matchesReference(graph, search);
+	}
+
+	return ok;
+}
+
+bool test_blocking_tiles_repairs_the_path() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 10; ++seed) {
+		auto graph = createRandomGrid(40, 30, 20, seed);
+		DStarLite search(graph, graph->numberOfNodes());
+		expandAll(search);
+
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<int> tile(0, graph->numberOfNodes() - 1);
+		for (int change = 0; change < 20; ++change) {
+			// a tile of the current path half of the time, any other tile otherwise
+			int node = tile(random);
+			if (change % 2 == 0 && search.parents()[graph->endNode()] >= 0) {
+				node = search.parents()[graph->endNode()];
+			}
+			if (node == graph->startNode() || node == graph->endNode()) {
+				continue;
+			}
+
+			graph->setBlocked(node % 40, node / 40, true);
+			search.tileChanged(node % 40, node / 40);
+			expandAll(search);
+			ok = ok && matchesReference(graph, search);
+		}
+	}
+
+	return ok;
+}
+
+bool test_clearing_tiles_repairs_the_path() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 10; ++seed) {
+		auto graph = createRandomGrid(40, 30, 40, seed);
+		DStarLite search(graph, graph->numberOfNodes());
+		expandAll(search);
+
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<int> tile(0, graph->numberOfNodes() - 1);
+		for (int change = 0; change < 30; ++change) {
+			int node = tile(random);
+			graph->setBlocked(node % 40, node / 40, false);
+			search.tileChanged(node % 40, node / 40);
+			expandAll(search);
+			ok = ok && matchesReference(graph, search);
+		}
+	}
+
+	return ok;
+}
+
+bool test_replanning_near_the_start_is_cheaper_than_searching_again() {
+	auto graph = createRandomGrid(100, 100, 15, 4);
+	graph->setBlocked(0, 0, false);
+	graph->setBlocked(99, 99, false);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(99, 99);
+
+	DStarLite search(graph, graph->numberOfNodes());
+	int first = expandAll(search);
+
+	// the second tile of the path gets blocked
+	int node = graph->endNode();
+	while (search.parents()[search.parents()[node]] != graph->startNode()) {
+		node = search.parents()[node];
+	}
+	graph->setBlocked(node % 100, node / 100, true);
+	search.tileChanged(node % 100, node / 100);
+	int replanned = expandAll(search);
+
+	return replanned * 10 < first && matchesReference(graph, search);
+}
+
+bool test_walled_off_end_and_reopened() {
+	auto graph = std::make_shared<GridGraph>(10, 6);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(9, 5);
+
+	DStarLite search(graph, graph->numberOfNodes());
+	expandAll(search);
+	bool ok = search.pathWeight() == 14;
+
+	for (int y = 0; y < 6; ++y) {
+		graph->setBlocked(7, y, true);
+		search.tileChanged(7, y);
+	}
+	expandAll(search);
+	ok = ok && search.pathWeight() < 0 && search.parents()[graph->endNode()] == -1;
+
+	graph->setBlocked(7, 2, false);
+	search.tileChanged(7, 2);
+	expandAll(search);
+
+	return ok && search.pathWeight() == 14 && matchesReference(graph, search);
+}
+
+bool test_moving_start_keeps_the_search() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 10; ++seed) {
+		auto graph = createRandomGrid(40, 30, 20, seed + 100);
+		DStarLite search(graph, graph->numberOfNodes());
+		expandAll(search);
+
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<int> tile(0, graph->numberOfNodes() - 1);
+		for (int move = 0; move < 10 && search.pathWeight() > 1; ++move) {
+			// the agent walks the first tile of the path and then sees a tile change somewhere
+			int next = graph->endNode();
+			while (search.parents()[next] != graph->startNode()) {
+				next = search.parents()[next];
+			}
+			graph->startNode() = next;
+			search.moveStart(next);
+
+			int node = tile(random);
+			if (node != graph->startNode() && node != graph->endNode()) {
+				graph->setBlocked(node % 40, node / 40, !graph->isBlocked(node % 40, node / 40));
+				search.tileChanged(node % 40, node / 40);
+			}
+			expandAll(search);
+			ok = ok && search.startNode() == graph->startNode() && matchesReference(graph, search);
+		}
+	}
+
+	return ok;
+}
+
+bool test_terrain_costs_match_weighted_dijkstra() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 10; ++seed) {
+		auto graph = createRandomGrid(40, 30, 15, seed);
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<int> tile(0, graph->numberOfNodes() - 1);
+		std::uniform_int_distribution<int> cost(1, 9);
+		for (int i = 0; i < 400; ++i) {
+			int node = tile(random);
+			graph->setCost(node % 40, node / 40, cost(random));
+		}
+
+		DStarLite search(graph, graph->numberOfNodes());
+		expandAll(search);
+		ok = ok && !graph->hasUniformEdgeWeights() && matchesWeightedReference(graph, search);
+
+		// costs going up and down, and tiles blocked, between the replans
+		for (int change = 0; change < 20; ++change) {
+			int node = tile(random);
+			if (change % 5 == 4 && node != graph->startNode() && node != graph->endNode()) {
+				graph->setBlocked(node % 40, node / 40, true);
+			}
+			else {
+				graph->setCost(node % 40, node / 40, cost(random));
+			}
+			search.tileChanged(node % 40, node / 40);
+			expandAll(search);
+			ok = ok && matchesWeightedReference(graph, search);
+		}
+	}
+
+	return ok;
+}
+
+bool matchesReference(std::shared_ptr<GridGraph> graph, const DStarLite& search) {
+	int expected = referenceDistance(graph);
+	return search.pathWeight() == expected && (expected < 0 || isPathOfGraph(*graph, search, expected));
+}
+
+bool matchesWeightedReference(std::shared_ptr<GridGraph> graph, const DStarLite& search) {
+	float expected = WeightedDijkstra<>(graph, graph->numberOfNodes()).solve().distance;
+	if (expected < 0.0f) {
+		return search.pathWeight() < 0 && search.parents()[graph->endNode()] == -1;
+	}
+
+	int edges = 0;
+	int weight = 0;
+	for (int node = graph->endNode(); node != graph->startNode() && node >= 0 && edges < graph->numberOfNodes(); node = search.parents()[node]) {
+		weight += graph->cellCost(node);
+		++edges;
+	}
+
+	return search.pathWeight() == static_cast<int>(expected) && weight == search.pathWeight() && isPathOfGraph(*graph, search, edges);
+}
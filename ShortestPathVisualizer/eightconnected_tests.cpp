@@ -0,0 +1,193 @@
+#include "AStar.h"
+#include "DaryHeap.h"
+#include "Dijkstra.h"
+#include "GridGraph.h"
+#include "IShortestPathStrategy.h"
+#include "JumpPointSearch.h"
+#include "SearchPolicies.h"
+#include "TestGrids.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_open_grid_distance_is_octile();
+bool test_corner_cutting_rules();
+bool test_octile_astar_matches_dijkstra();
+bool test_never_cutting_matches_jump_point_search();
+bool test_diagonals_scale_with_terrain();
+
+bool nearlyEqual(float left, float right);
+// consecutive cells of the path are one move apart (straight or diagonal) and free
+bool isEightConnectedPath(const GridGraph& graph, const SearchResult& result);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 5;
+
+	TEST(test_open_grid_distance_is_octile, errCount, okCount);
+	TEST(test_corner_cutting_rules, errCount, okCount);
+	TEST(test_octile_astar_matches_dijkstra, errCount, okCount);
+	TEST(test_never_cutting_matches_jump_point_search, errCount, okCount);
+	TEST(test_diagonals_scale_with_terrain, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_open_grid_distance_is_octile() {
+	auto graph = std::make_shared<GridGraph>(8, 6);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(5, 3);
+
+	SearchResult dijkstra = OctileDijkstra<>(graph, graph->numberOfNodes()).solve();
+	SearchResult astar = OctileAStar<>(graph, graph->numberOfNodes()).solve();
+	float expected = 3.0f * GridGraph::diagonalCost + 2.0f;
+
+	return nearlyEqual(dijkstra.distance, expected) && nearlyEqual(astar.distance, expected) &&
+		dijkstra.path.size() == 6 && astar.path.size() == 6;
+}
+
+bool test_corner_cutting_rules() {
+	// from (0, 0) to (1, 1) with (1, 0) blocked
+	auto graph = std::make_shared<GridGraph>(2, 2);
+	graph->setBlocked(1, 0, true);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(1, 1);
+
+	bool ok = nearlyEqual(OctileDijkstra<DaryHeap<4>, CornerCutting::Never>(graph, 4).solve().distance, 2.0f) &&
+		nearlyEqual(OctileDijkstra<DaryHeap<4>, CornerCutting::OneCorner>(graph, 4).solve().distance, GridGraph::diagonalCost) &&
+		nearlyEqual(OctileDijkstra<DaryHeap<4>, CornerCutting::Always>(graph, 4).solve().distance, GridGraph::diagonalCost);
+
+	// (0, 1) blocked too, only squeezing between both corners gets there
+	graph->setBlocked(0, 1, true);
+	ok = ok && OctileDijkstra<DaryHeap<4>, CornerCutting::Never>(graph, 4).solve().path.empty() &&
+		OctileAStar<DaryHeap<4>, CornerCutting::OneCorner>(graph, 4).solve().path.empty() &&
+		nearlyEqual(OctileAStar<DaryHeap<4>, CornerCutting::Always>(graph, 4).solve().distance, GridGraph::diagonalCost);
+
+	return ok;
+}
+
+bool test_octile_astar_matches_dijkstra() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 30, seed);
+		int capacity = graph->numberOfNodes();
+
+		SearchResult never = OctileDijkstra<>(graph, capacity).solve();
+		SearchResult oneCorner = OctileDijkstra<DaryHeap<4>, CornerCutting::OneCorner>(graph, capacity).solve();
+		SearchResult always = OctileDijkstra<DaryHeap<2>, CornerCutting::Always>(graph, capacity).solve();
+
+		SearchResult astarNever = OctileAStar<>(graph, capacity).solve();
+		SearchResult astarOneCorner = OctileAStar<DaryHeap<4>, CornerCutting::OneCorner>(graph, capacity).solve();
+		SearchResult astarAlways = OctileAStar<DaryHeap<2>, CornerCutting::Always>(graph, capacity).solve();
+
+		ok = nearlyEqual(never.distance, astarNever.distance) && nearlyEqual(oneCorner.distance, astarOneCorner.distance) &&
+			nearlyEqual(always.distance, astarAlways.distance) &&
+			// every rule allows more moves than the one before it
+			(never.path.empty() || (oneCorner.distance <= never.distance + 1e-3f && always.distance <= oneCorner.distance + 1e-3f)) &&
+			isEightConnectedPath(*graph, never) && isEightConnectedPath(*graph, astarAlways);
+	}
+
+	return ok;
+}
+
+bool test_never_cutting_matches_jump_point_search() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 25, seed);
+		SearchResult octile = OctileAStar<>(graph, graph->numberOfNodes()).solve();
+		SearchResult jumps = JumpPointSearch(graph, graph->numberOfNodes(), GridMovement::EightConnected).solve();
+
+		ok = octile.path.empty() == jumps.path.empty() && (octile.path.empty() || nearlyEqual(octile.distance, jumps.distance));
+	}
+
+	return ok;
+}
+
+bool test_diagonals_scale_with_terrain() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(30, 20, 20, seed);
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<int> cost(2, 6);
+		for (int y = 0; y < graph->height(); ++y) {
+			for (int x = 0; x < graph->width(); ++x) {
+				graph->setCost(x, y, cost(random));
+			}
+		}
+
+		// the octile distance is scaled by the cheapest cell (2), A* still finds the cheapest path
+		SearchResult dijkstra = OctileDijkstra<>(graph, graph->numberOfNodes()).solve();
+		SearchResult astar = OctileAStar<>(graph, graph->numberOfNodes()).solve();
+		ok = nearlyEqual(dijkstra.distance, astar.distance);
+
+		if (ok && !dijkstra.path.empty()) {
+			float cost = 0.0f;
+			for (size_t i = 1; i < dijkstra.path.size(); ++i) {
+				bool diagonal = std::abs(dijkstra.path[i] - dijkstra.path[i - 1]) != 1 && std::abs(dijkstra.path[i] - dijkstra.path[i - 1]) != graph->width();
+				cost += (diagonal ? GridGraph::diagonalCost : 1.0f) * graph->cellCost(dijkstra.path[i]);
+			}
+			ok = nearlyEqual(cost, dijkstra.distance);
+		}
+	}
+
+	return ok;
+}
+
+bool nearlyEqual(float left, float right) {
+	return std::fabs(left - right) <= 1e-3f * std::max(1.0f, std::fabs(right));
+}
+
+bool isEightConnectedPath(const GridGraph& graph, const SearchResult& result) {
+	if (result.path.empty()) {
+		return result.distance < 0.0f;
+	}
+
+	for (size_t i = 0; i < result.path.size(); ++i) {
+		int x = 0;
+		int y = 0;
+		graph.coordinates(result.path[i], x, y);
+		if (graph.isBlocked(x, y)) {
+			return false;
+		}
+		if (i > 0) {
+			int previousX = 0;
+			int previousY = 0;
+			graph.coordinates(result.path[i - 1], previousX, previousY);
+			if (std::abs(x - previousX) > 1 || std::abs(y - previousY) > 1 || result.path[i] == result.path[i - 1]) {
+				return false;
+			}
+		}
+	}
+
+	return result.path.front() == graph.startNode() && result.path.back() == graph.endNode();
+}
@@ -0,0 +1,171 @@
+#include "Graph.h"
+#include "GraphBuilder.h"
+#include "IGraph.h"
+
+#include <assert.h>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_neighbors_keep_the_order_of_the_lists();
+bool test_isolated_nodes_have_no_neighbors();
+bool test_number_of_edges_counts_every_list_entry();
+bool test_nodes_keep_their_coordinates();
+bool test_graph_without_edges();
+bool test_random_graphs_match_their_lists();
+
+// builder with one node per list at (index, 2 * index), the start the first node and the end the last one
+GraphBuilder createBuilder(const std::vector<std::list<int>>& adjacencyList);
+// the neighbors of every node (through both neighbors() overloads) are its list, in the same order
+bool sameNeighbors(const Graph& graph, const std::vector<std::list<int>>& adjacencyList);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_neighbors_keep_the_order_of_the_lists, errCount, okCount);
+	TEST(test_isolated_nodes_have_no_neighbors, errCount, okCount);
+	TEST(test_number_of_edges_counts_every_list_entry, errCount, okCount);
+	TEST(test_nodes_keep_their_coordinates, errCount, okCount);
+	TEST(test_graph_without_edges, errCount, okCount);
+	TEST(test_random_graphs_match_their_lists, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_neighbors_keep_the_order_of_the_lists() {
+	// directed on purpose: 2 -> 0 has no way back, and 3 lists 1 twice
+	std::vector<std::list<int>> adjacencyList = { { 1, 2 }, { 3, 0, 2 }, { 0 }, { 1, 1 } };
+	std::shared_ptr<Graph> graph = createBuilder(adjacencyList).build();
+
+	return sameNeighbors(*graph, adjacencyList);
+}
+
+bool test_isolated_nodes_have_no_neighbors() {
+	// the first, a middle and the last node are isolated: empty rows at both ends of the offsets
+	std::vector<std::list<int>> adjacencyList = { {}, { 2, 4 }, {}, { 1 }, { 1, 3 }, {} };
+	std::shared_ptr<Graph> graph = createBuilder(adjacencyList).build();
+
+	IGraph::NeighborBuffer buffer;
+	bool ok = sameNeighbors(*graph, adjacencyList);
+	for (int node : { 0, 2, 5 }) {
+		ok = ok && graph->neighbors(node).isEmpty() && graph->neighbors(node, buffer).size() == 0;
+	}
+
+	return ok;
+}
+
+bool test_number_of_edges_counts_every_list_entry() {
+	std::vector<std::list<int>> adjacencyList = { { 1, 2 }, { 0 }, { 0 }, {} };
+	std::shared_ptr<Graph> graph = createBuilder(adjacencyList).build();
+
+	// an undirected edge is in the list of both nodes, so it counts twice
+	return graph->numberOfEdges() == 4 && graph->numberOfNodes() == 4;
+}
+
+bool test_nodes_keep_their_coordinates() {
+	std::vector<std::list<int>> adjacencyList = { { 1 }, { 0, 2 }, { 1 }, {} };
+	GraphBuilder builder = createBuilder(adjacencyList);
+	builder.startNode() = 1;
+	builder.endNode() = 3;
+	std::shared_ptr<Graph> graph = builder.build();
+
+	bool ok = graph->nodes() == builder.nodes() && graph->startNode() == 1 && graph->endNode() == 3;
+	for (int node = 0; node < graph->numberOfNodes(); ++node) {
+		int x = -1;
+		int y = -1;
+		graph->coordinates(node, x, y);
+		ok = ok && x == node && y == 2 * node && graph->nodes()[node].index == node;
+	}
+
+	return ok;
+}
+
+bool test_graph_without_edges() {
+	std::vector<std::list<int>> adjacencyList(5);
+	std::shared_ptr<Graph> graph = createBuilder(adjacencyList).build();
+
+	return graph->numberOfEdges() == 0 && graph->numberOfNodes() == 5 && sameNeighbors(*graph, adjacencyList);
+}
+
+bool test_random_graphs_match_their_lists() {
+	std::mt19937 random(3);
+	bool ok = true;
+	for (int numberOfNodes : { 1, 2, 17, 300 }) {
+		std::uniform_int_distribution<int> node(0, numberOfNodes - 1);
+		std::uniform_int_distribution<int> degree(0, 6);
+
+		std::vector<std::list<int>> adjacencyList(numberOfNodes);
+		size_t edges = 0;
+		for (auto& adjacents : adjacencyList) {
+			for (int i = degree(random); i > 0; --i) {
+				adjacents.push_back(node(random));
+				++edges;
+			}
+		}
+		std::shared_ptr<Graph> graph = createBuilder(adjacencyList).build();
+
+		ok = ok && graph->numberOfEdges() == edges && sameNeighbors(*graph, adjacencyList);
+	}
+
+	return ok;
+}
+
+GraphBuilder createBuilder(const std::vector<std::list<int>>& adjacencyList) {
+	int numberOfNodes = static_cast<int>(adjacencyList.size());
+
+	GraphBuilder builder(numberOfNodes);
+	for (int i = 0; i < numberOfNodes; ++i) {
+		builder.nodes().push_back(Graph::Node{ i, i, 2 * i, -1 });
+		builder.adjacencyList().push_back(adjacencyList[i]);
+	}
+	builder.startNode() = 0;
+	builder.endNode() = numberOfNodes - 1;
+
+	return builder;
+}
+
+bool sameNeighbors(const Graph& graph, const std::vector<std::list<int>>& adjacencyList) {
+	if (graph.numberOfNodes() != static_cast<int>(adjacencyList.size())) {
+		return false;
+	}
+
+	IGraph::NeighborBuffer buffer;
+	bool ok = true;
+	for (int node = 0; node < graph.numberOfNodes(); ++node) {
+		std::vector<int> expected(adjacencyList[node].begin(), adjacencyList[node].end());
+		IGraph::NeighborRange range = graph.neighbors(node);
+		IGraph::NeighborRange virtualRange = graph.neighbors(node, buffer);
+
+		ok = ok && std::vector<int>(range.begin(), range.end()) == expected &&
+			std::vector<int>(virtualRange.begin(), virtualRange.end()) == expected && range.size() == static_cast<int>(expected.size());
+	}
+
+	return ok;
+}
@@ -0,0 +1,248 @@
+#include "GridGraph.h"
+#include "IGraph.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_neighbors_match_a_plain_array();
+bool test_rows_do_not_wrap_at_word_boundaries();
+bool test_padding_bits_stay_clear();
+bool test_index_and_coordinates_round_trip();
+bool test_edits_change_the_version();
+bool test_bit_scans();
+
+// free up, down, left and right cells of (x, y) in a [y][x] array of blocked cells, empty if (x, y) is blocked
+std::vector<int> plainNeighbors(const std::vector<std::vector<bool>>& blocked, int x, int y);
+// neighbors() of every cell is plainNeighbors, in the same order
+bool sameNeighbors(const GridGraph& graph, const std::vector<std::vector<bool>>& blocked);
+// every bit of the last word of a row past the width is 0
+bool paddingIsClear(const GridGraph& graph);
+
+/**********  END FUNCTIONS  *************/
+
+// around the 64 cells of a word of the obstacle bitmap
+const std::vector<int> widths = { 1, 2, 63, 64, 65, 127, 128, 130 };
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_neighbors_match_a_plain_array, errCount, okCount);
+	TEST(test_rows_do_not_wrap_at_word_boundaries, errCount, okCount);
+	TEST(test_padding_bits_stay_clear, errCount, okCount);
+	TEST(test_index_and_coordinates_round_trip, errCount, okCount);
+	TEST(test_edits_change_the_version, errCount, okCount);
+	TEST(test_bit_scans, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_neighbors_match_a_plain_array() {
+	std::mt19937 random(5);
+	std::uniform_int_distribution<int> percent(0, 99);
+
+	bool ok = true;
+	for (int width : widths) {
+		for (int height : { 1, 2, 7 }) {
+			for (int obstaclePercent : { 0, 30, 70, 100 }) {
+				GridGraph graph(width, height);
+				std::vector<std::vector<bool>> blocked(height, std::vector<bool>(width, false));
+				for (int y = 0; y < height; ++y) {
+					for (int x = 0; x < width; ++x) {
+						blocked[y][x] = percent(random) < obstaclePercent;
+						graph.setBlocked(x, y, blocked[y][x]);
+					}
+				}
+
+				ok = ok && graph.wordsPerRow() == (width + 63) / 64 && sameNeighbors(graph, blocked);
+			}
+		}
+	}
+
+	return ok;
+}
+
+bool test_rows_do_not_wrap_at_word_boundaries() {
+	bool ok = true;
+	for (int width : widths) {
+		// only the first and last cell of every row free: the last cell of a row (in the last word of the row)
+		// and the first of the next one have consecutive indices but are not neighbors
+		const int height = 3;
+		GridGraph graph(width, height);
+		std::vector<std::vector<bool>> blocked(height, std::vector<bool>(width, true));
+		for (int y = 0; y < height; ++y) {
+			for (int x = 0; x < width; ++x) {
+				blocked[y][x] = x != 0 && x != width - 1;
+				graph.setBlocked(x, y, blocked[y][x]);
+			}
+		}
+
+		ok = ok && sameNeighbors(graph, blocked);
+		for (int x : { 62, 63, 64, 65, width - 1 }) {
+			ok = ok && (x < 0 || x >= width || graph.isBlocked(x, 1) == blocked[1][x]);
+		}
+	}
+
+	return ok;
+}
+
+bool test_padding_bits_stay_clear() {
+	bool ok = true;
+	for (int width : widths) {
+		GridGraph graph(width, 4);
+		for (int y = 0; y < 4; ++y) {
+			for (int x = 0; x < width; ++x) {
+				graph.setBlocked(x, y, true);
+			}
+		}
+		ok = ok && paddingIsClear(graph);
+
+		IGraph::NeighborBuffer buffer;
+		for (int node = 0; node < graph.numberOfNodes(); ++node) {
+			ok = ok && graph.neighbors(node, buffer).isEmpty();
+		}
+
+		for (int y = 0; y < 4; ++y) {
+			graph.setBlocked(width - 1, y, false);
+		}
+		ok = ok && paddingIsClear(graph);
+	}
+
+	return ok;
+}
+
+bool test_index_and_coordinates_round_trip() {
+	bool ok = true;
+	for (int width : widths) {
+		GridGraph graph(width, 5);
+		ok = ok && graph.numberOfNodes() == width * 5;
+		for (int node = 0; node < graph.numberOfNodes(); ++node) {
+			int x = -1;
+			int y = -1;
+			graph.coordinates(node, x, y);
+			ok = ok && x >= 0 && x < width && y >= 0 && y < 5 && graph.index(x, y) == node;
+		}
+	}
+
+	return ok;
+}
+
+bool test_edits_change_the_version() {
+	// the same graph is searched again after a wall is added and removed
+	auto graph = std::make_shared<GridGraph>(5, 5);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(4, 0);
+
+	bool ok = graph->version() == 0;
+	for (int y = 0; y < 4; ++y) {
+		graph->setBlocked(2, y, true);
+	}
+	ok = ok && graph->version() == 4;
+
+	// blocking a blocked cell changes nothing
+	graph->setBlocked(2, 0, true);
+	ok = ok && graph->version() == 4 && referenceDistance(graph) == 12;
+
+	graph->setBlocked(2, 0, false);
+	ok = ok && graph->version() == 5 && referenceDistance(graph) == 4;
+
+	// the same goes for costs: only a different cost is an edit
+	graph->setCost(1, 1, 3);
+	graph->setCost(1, 1, 3);
+	ok = ok && graph->version() == 6;
+	graph->setCost(1, 1, 1);
+
+	return ok && graph->version() == 7 && graph->hasUniformEdgeWeights();
+}
+
+bool test_bit_scans() {
+	bool ok = true;
+	for (int low = 0; low < 64; ++low) {
+		for (int high = low; high < 64; ++high) {
+			uint64_t word = (uint64_t(1) << low) | (uint64_t(1) << high);
+			ok = ok && GridGraph::lowestBit(word) == low && GridGraph::highestBit(word) == high;
+		}
+	}
+
+	return ok && GridGraph::lowestBit(~uint64_t(0)) == 0 && GridGraph::highestBit(~uint64_t(0)) == 63;
+}
+
+std::vector<int> plainNeighbors(const std::vector<std::vector<bool>>& blocked, int x, int y) {
+	int height = static_cast<int>(blocked.size());
+	int width = static_cast<int>(blocked[0].size());
+
+	std::vector<int> neighbors;
+	if (blocked[y][x]) {
+		return neighbors;
+	}
+	if (y > 0 && !blocked[y - 1][x]) {
+		neighbors.push_back(x + (y - 1) * width);
+	}
+	if (y + 1 < height && !blocked[y + 1][x]) {
+		neighbors.push_back(x + (y + 1) * width);
+	}
+	if (x > 0 && !blocked[y][x - 1]) {
+		neighbors.push_back(x - 1 + y * width);
+	}
+	if (x + 1 < width && !blocked[y][x + 1]) {
+		neighbors.push_back(x + 1 + y * width);
+	}
+
+	return neighbors;
+}
+
+bool sameNeighbors(const GridGraph& graph, const std::vector<std::vector<bool>>& blocked) {
+	IGraph::NeighborBuffer buffer;
+	bool ok = true;
+	for (int y = 0; y < graph.height(); ++y) {
+		for (int x = 0; x < graph.width(); ++x) {
+			IGraph::NeighborRange range = graph.neighbors(graph.index(x, y), buffer);
+			ok = ok && graph.isBlocked(x, y) == blocked[y][x] &&
+				std::vector<int>(range.begin(), range.end()) == plainNeighbors(blocked, x, y);
+		}
+	}
+
+	return ok;
+}
+
+bool paddingIsClear(const GridGraph& graph) {
+	int usedBits = graph.width() & 63;
+	if (usedBits == 0) {
+		return true;
+	}
+
+	uint64_t padding = ~((uint64_t(1) << usedBits) - 1);
+	bool ok = true;
+	for (int y = 0; y < graph.height(); ++y) {
+		ok = ok && (graph.blockedBits()[(y + 1) * graph.wordsPerRow() - 1] & padding) == 0;
+	}
+
+	return ok;
+}
@@ -0,0 +1,270 @@
+#include "GridGraph.h"
+#include "GridMapLoader.h"
+#include "IShortestPathStrategy.h"
+#include "QueryRunner.h"
+#include "ScenarioRunner.h"
+#include "ShortestPathStrategyFactory.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_load_map_cells_and_costs();
+bool test_load_map_skips_comments_and_windows_endings();
+bool test_malformed_maps_are_rejected();
+bool test_load_queries();
+bool test_malformed_queries_are_rejected();
+bool test_runner_matches_solve_in_query_order();
+bool test_load_movingai_map();
+bool test_malformed_movingai_maps_are_rejected();
+bool test_load_scenarios();
+bool test_malformed_scenarios_are_rejected();
+
+std::shared_ptr<GridGraph> loadMap(const std::string& text, std::string& error);
+
+/**********  END FUNCTIONS  *************/
+
+const char* smallMap =
+	"......\n"
+	".##.3.\n"
+	"...#..\n";
+
+const char* movingAIMap =
+	"type octile\r\n"
+	"height 3\r\n"
+	"width 5\r\n"
+	"map\r\n"
+	".G@O.\r\n"
+	"S.TW.\r\n"
+	".....\r\n";
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 10;
+
+	TEST(test_load_map_cells_and_costs, errCount, okCount);
+	TEST(test_load_map_skips_comments_and_windows_endings, errCount, okCount);
+	TEST(test_malformed_maps_are_rejected, errCount, okCount);
+	TEST(test_load_queries, errCount, okCount);
+	TEST(test_malformed_queries_are_rejected, errCount, okCount);
+	TEST(test_runner_matches_solve_in_query_order, errCount, okCount);
+	TEST(test_load_movingai_map, errCount, okCount);
+	TEST(test_malformed_movingai_maps_are_rejected, errCount, okCount);
+	TEST(test_load_scenarios, errCount, okCount);
+	TEST(test_malformed_scenarios_are_rejected, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_load_map_cells_and_costs() {
+	std::string error;
+	auto graph = loadMap(smallMap, error);
+
+	return graph && graph->width() == 6 && graph->height() == 3 && !graph->isBlocked(0, 0) &&
+		graph->isBlocked(1, 1) && graph->isBlocked(2, 1) && graph->isBlocked(3, 2) && !graph->isBlocked(4, 1) &&
+		graph->cost(4, 1) == 3 && graph->cost(5, 1) == 1 && !graph->hasUniformEdgeWeights();
+}
+
+bool test_load_map_skips_comments_and_windows_endings() {
+	std::string error;
+	auto graph = loadMap("; a comment\r\n..#\r\n\r\n#..\r\n", error);
+
+	return graph && graph->width() == 3 && graph->height() == 2 && graph->isBlocked(2, 0) && graph->isBlocked(0, 1) &&
+		graph->hasUniformEdgeWeights();
+}
+
+bool test_malformed_maps_are_rejected() {
+	std::string error;
+	bool ok = !loadMap("...\n..\n", error) && error.find("line 2") != std::string::npos;
+
+	error.clear();
+	ok = ok && !loadMap("...\n.x.\n", error) && error.find("line 2") != std::string::npos;
+
+	// a cost of 1 is written '.'
+	error.clear();
+	ok = ok && !loadMap(".1.\n", error) && !error.empty();
+
+	error.clear();
+	return ok && !loadMap("; only a comment\n", error) && !error.empty();
+}
+
+bool test_load_queries() {
+	std::string error;
+	auto graph = loadMap(smallMap, error);
+
+	std::istringstream input("0 0 5 2\n; a comment\n\n4 1 0 2\r\n");
+	std::vector<GridQuery> queries;
+	bool ok = GridMapLoader::loadQueries(input, *graph, queries, error);
+
+	return ok && queries.size() == 2 && queries[0].startX == 0 && queries[0].startY == 0 && queries[0].endX == 5 &&
+		queries[0].endY == 2 && queries[1].startX == 4 && queries[1].startY == 1 && queries[1].endX == 0 && queries[1].endY == 2;
+}
+
+bool test_malformed_queries_are_rejected() {
+	std::string error;
+	auto graph = loadMap(smallMap, error);
+
+	const char* inputs[] = {
+		"0 0 5\n",			// missing a coordinate
+		"0 0 5 2 1\n",		// one too many
+		"0 0 a 2\n",		// not a number
+		"0 0 6 2\n",		// outside the map
+		"0 0 1 1\n"			// blocked
+	};
+
+	bool ok = true;
+	for (const char* text : inputs) {
+		std::istringstream input(std::string("0 0 5 2\n") + text);
+		std::vector<GridQuery> queries;
+		error.clear();
+		ok = ok && !GridMapLoader::loadQueries(input, *graph, queries, error) && error.find("line 2") != std::string::npos;
+	}
+
+	return ok;
+}
+
+bool test_runner_matches_solve_in_query_order() {
+	std::string error;
+	auto graph = loadMap(
+		"..........\n"
+		".####.....\n"
+		"....#..99.\n"
+		".##.#..99.\n"
+		"....#..###\n"
+		"....#..#..\n", error);
+	std::vector<GridQuery> queries = {
+		{ 0, 0, 9, 3 },
+		{ 0, 5, 5, 0 },
+		{ 2, 2, 8, 3 },
+		{ 0, 0, 9, 5 },		// walled in
+		{ 3, 3, 3, 3 }
+	};
+
+	bool ok = true;
+	for (ShortestPathAlgorithm algorithm : { ShortestPathAlgorithm::Dijkstra, ShortestPathAlgorithm::AStar, ShortestPathAlgorithm::BidirectionalAStar,
+		ShortestPathAlgorithm::JumpPointSearch }) {
+		QueryRunner runner(graph, algorithm);
+		std::vector<GridQueryResult> results = runner.run(queries);
+		ok = ok && results.size() == queries.size();
+
+		for (size_t i = 0; i < queries.size() && ok; ++i) {
+			graph->startNode() = graph->index(queries[i].startX, queries[i].startY);
+			graph->endNode() = graph->index(queries[i].endX, queries[i].endY);
+			SearchResult expected = ShortestPathStrategyFactory::create(algorithm, graph, graph->numberOfNodes())->solve();
+
+			// a search from a cell to itself can stop before expanding anything
+			ok = results[i].cost == expected.distance && (results[i].expansions > 0 || expected.distance == 0.0f) &&
+				results[i].milliseconds >= 0.0;
+		}
+	}
+
+	return ok;
+}
+
+bool test_load_movingai_map() {
+	std::string error;
+	auto graph = loadMap(movingAIMap, error);
+	if (!graph || graph->width() != 5 || graph->height() != 3 || !graph->hasUniformEdgeWeights()) {
+		return false;
+	}
+
+	const char* rows[] = { ".G@O.", "S.TW.", "....." };
+	bool ok = true;
+	for (int y = 0; y < 3; ++y) {
+		for (int x = 0; x < 5; ++x) {
+			char cell = rows[y][x];
+			ok = ok && graph->isBlocked(x, y) == (cell == '@' || cell == 'O' || cell == 'T' || cell == 'W');
+		}
+	}
+
+	return ok;
+}
+
+bool test_malformed_movingai_maps_are_rejected() {
+	const char* inputs[] = {
+		"type octile\nheight 2\nwidth 3\n...\n...\n",					// no map line
+		"type octile\nheight 2\nwidth 3\nmap\n...\n",					// a row missing
+		"type octile\nheight 2\nwidth 3\nmap\n...\n....\n",			// a row too long
+		"type octile\nheight 2\nwidth 3\nmap\n...\n.#.\n",				// not a MovingAI cell
+		"type octile\nheight 0\nwidth 3\nmap\n",						// no rows
+		"type octile\ndepth 2\nwidth 3\nmap\n...\n...\n"				// unknown header
+	};
+
+	bool ok = true;
+	for (const char* text : inputs) {
+		std::string error;
+		ok = ok && !loadMap(text, error) && !error.empty();
+	}
+
+	return ok;
+}
+
+bool test_load_scenarios() {
+	std::string error;
+	auto graph = loadMap(movingAIMap, error);
+
+	std::istringstream input(
+		"version 1\r\n"
+		"0\tsmall.map\t5\t3\t0\t0\t4\t2\t4.82842712\r\n"
+		"1\tsmall.map\t5\t3\t4\t0\t0\t1\t5.41421356\r\n");
+	std::vector<Scenario> scenarios;
+	bool ok = GridMapLoader::loadScenarios(input, *graph, scenarios, error);
+
+	return ok && scenarios.size() == 2 && scenarios[0].bucket == 0 && scenarios[0].map == "small.map" && scenarios[0].mapWidth == 5 &&
+		scenarios[0].mapHeight == 3 && scenarios[0].query.startX == 0 && scenarios[0].query.startY == 0 && scenarios[0].query.endX == 4 &&
+		scenarios[0].query.endY == 2 && scenarios[0].optimalLength == 4.82842712 && scenarios[1].bucket == 1 && scenarios[1].query.startX == 4 &&
+		scenarios[1].query.endY == 1 && scenarios[1].optimalLength == 5.41421356;
+}
+
+bool test_malformed_scenarios_are_rejected() {
+	std::string error;
+	auto graph = loadMap(movingAIMap, error);
+
+	const char* inputs[] = {
+		"0 small.map 5 3 0 0 4 2 4.8\n",							// no version line
+		"version 1\n0 small.map 5 3 0 0 4 2\n",					// no length
+		"version 1\n0 small.map 6 3 0 0 4 2 4.8\n",				// made for another map
+		"version 1\n0 small.map 5 3 0 0 2 0 4.8\n",				// blocked end
+		"version 1\n0 small.map 5 3 0 0 5 2 4.8\n"					// outside the map
+	};
+
+	bool ok = true;
+	for (const char* text : inputs) {
+		std::istringstream input(text);
+		std::vector<Scenario> scenarios;
+		error.clear();
+		ok = ok && !GridMapLoader::loadScenarios(input, *graph, scenarios, error) && !error.empty();
+	}
+
+	return ok;
+}
+
+std::shared_ptr<GridGraph> loadMap(const std::string& text, std::string& error) {
+	std::istringstream input(text);
+	return GridMapLoader::loadMap(input, error);
+}
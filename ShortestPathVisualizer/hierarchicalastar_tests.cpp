@@ -0,0 +1,218 @@
+#include "ClusterAbstraction.h"
+#include "GridGraph.h"
+#include "HierarchicalAStar.h"
+#include "IGraph.h"
+#include "TestGrids.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_entrances_of_an_open_grid();
+bool test_walls_split_entrances();
+bool test_paths_are_valid_and_near_optimal();
+bool test_unreachable_end();
+bool test_start_equals_end();
+bool test_invalidate_matches_a_new_abstraction();
+
+bool sameAbstraction(const ClusterAbstraction& first, const ClusterAbstraction& second);
+// (tile of the target, weight) of the edges of every entrance tile, sorted
+std::vector<std::vector<std::pair<int, int>>> edgesByTile(const ClusterAbstraction& clusters);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_entrances_of_an_open_grid, errCount, okCount);
+	TEST(test_walls_split_entrances, errCount, okCount);
+	TEST(test_paths_are_valid_and_near_optimal, errCount, okCount);
+	TEST(test_unreachable_end, errCount, okCount);
+	TEST(test_start_equals_end, errCount, okCount);
+	TEST(test_invalidate_matches_a_new_abstraction, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_entrances_of_an_open_grid() {
+	// 2x2 clusters of 10x10, every border is one long stretch with an entrance at each end,
+	// so a cluster has its 3 corners next to other clusters as entrances
+	auto graph = std::make_shared<GridGraph>(20, 20);
+	ClusterAbstraction clusters(graph, 10);
+
+	bool ok = clusters.numberOfClusters() == 4 && clusters.numberOfEntrances() == 12;
+	for (int cluster = 0; cluster < 4; ++cluster) {
+		ok = ok && clusters.nodes(cluster).size() == 3;
+	}
+
+	// (9, 0): a step to (10, 0) and the paths to the other corners of its cluster
+	int corner = -1;
+	for (int node = 0; node < clusters.numberOfNodes(); ++node) {
+		corner = clusters.cell(node) == graph->index(9, 0) ? node : corner;
+	}
+	if (corner < 0) {
+		return false;
+	}
+
+	for (const ClusterAbstraction::Edge& edge : clusters.edges(corner)) {
+		int cell = clusters.cell(edge.target);
+		ok = ok && ((cell == graph->index(10, 0) && edge.weight == 1) ||
+			(cell == graph->index(9, 9) && edge.weight == 9) ||
+			(cell == graph->index(0, 9) && edge.weight == 18));
+	}
+
+	return ok && clusters.edges(corner).size() == 3;
+}
+
+bool test_walls_split_entrances() {
+	// the east border of the first cluster has stretches of 1, 3 and 1 tiles
+	auto graph = std::make_shared<GridGraph>(16, 16);
+	for (int y : { 1, 5, 7 }) {
+		graph->setBlocked(8, y, true);
+	}
+	ClusterAbstraction clusters(graph, 8);
+
+	std::vector<int> entrances;
+	for (int node : clusters.nodes(0)) {
+		entrances.push_back(clusters.cell(node));
+	}
+
+	// one entrance in the middle of every stretch, plus the ends of the south border
+	return entrances == std::vector<int>{ graph->index(7, 0), graph->index(7, 3), graph->index(7, 6), graph->index(0, 7), graph->index(7, 7) };
+}
+
+bool test_paths_are_valid_and_near_optimal() {
+	bool ok = true;
+	int totalLength = 0;
+	int totalOptimal = 0;
+	for (unsigned int seed = 1; seed <= 60; ++seed) {
+		auto graph = createRandomGrid(60, 45, 10 + seed % 4 * 8, seed);
+		auto clusters = std::make_shared<ClusterAbstraction>(graph, 5 + seed % 3 * 5);
+
+		HierarchicalAStar search(graph, clusters, graph->numberOfNodes());
+		expandAll(search);
+
+		int expected = referenceDistance(graph);
+		ok = ok && (expected < 0 ? search.pathWeight() < 0 :
+			search.pathWeight() >= expected && isPathOfGraph(*graph, search, search.pathWeight()));
+		if (expected > 0) {
+			totalLength += search.pathWeight();
+			totalOptimal += expected;
+		}
+	}
+
+	// HPA* paths are known to be within a few percent of the optimal ones
+	return ok && totalLength * 100 <= totalOptimal * 105;
+}
+
+bool test_unreachable_end() {
+	// the right column is cut off by a wall
+	auto graph = std::make_shared<GridGraph>(20, 10);
+	for (int y = 0; y < 10; ++y) {
+		graph->setBlocked(18, y, true);
+	}
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(19, 9);
+
+	HierarchicalAStar search(graph, std::make_shared<ClusterAbstraction>(graph, 5), graph->numberOfNodes());
+	expandAll(search);
+
+	return search.pathWeight() < 0 && search.parents()[graph->endNode()] == -1;
+}
+
+bool test_start_equals_end() {
+	auto graph = std::make_shared<GridGraph>(20, 10);
+	graph->startNode() = graph->index(12, 3);
+	graph->endNode() = graph->index(12, 3);
+
+	HierarchicalAStar search(graph, std::make_shared<ClusterAbstraction>(graph, 5), graph->numberOfNodes());
+	expandAll(search);
+
+	return search.pathWeight() == 0 && search.parents()[graph->endNode()] == -1;
+}
+
+bool test_invalidate_matches_a_new_abstraction() {
+	auto graph = createRandomGrid(50, 37, 20, 3);
+	ClusterAbstraction clusters(graph, 8);
+
+	bool ok = true;
+	std::mt19937 random(5);
+	std::uniform_int_distribution<int> x(0, graph->width() - 1);
+	std::uniform_int_distribution<int> y(0, graph->height() - 1);
+	for (int change = 0; change < 40; ++change) {
+		// a new copy of the grid each time, like the visualizer does
+		auto changed = std::make_shared<GridGraph>(*graph);
+		int tiles = 1 + change % 3;
+		for (int tile = 0; tile < tiles; ++tile) {
+			int tileX = x(random);
+			int tileY = y(random);
+			changed->setBlocked(tileX, tileY, !changed->isBlocked(tileX, tileY));
+			clusters.invalidate(tileX, tileY);
+		}
+		graph = changed;
+		clusters.setGraph(graph);
+
+		// each tile touches its cluster and at most the two on the other side of its borders
+		int updated = clusters.update();
+		ok = ok && updated >= 1 && updated <= tiles * 3;
+		ok = ok && sameAbstraction(clusters, ClusterAbstraction(graph, 8));
+	}
+
+	return ok;
+}
+
+bool sameAbstraction(const ClusterAbstraction& first, const ClusterAbstraction& second) {
+	// the nodes can be numbered differently, entrances and edges are compared by tile
+	std::vector<std::vector<std::pair<int, int>>> firstEdges = edgesByTile(first);
+	std::vector<std::vector<std::pair<int, int>>> secondEdges = edgesByTile(second);
+
+	return first.numberOfEntrances() == second.numberOfEntrances() && firstEdges == secondEdges;
+}
+
+std::vector<std::vector<std::pair<int, int>>> edgesByTile(const ClusterAbstraction& clusters) {
+	int numberOfTiles = 0;
+	for (int node = 0; node < clusters.numberOfNodes(); ++node) {
+		numberOfTiles = std::max(numberOfTiles, clusters.cell(node) + 1);
+	}
+
+	std::vector<std::vector<std::pair<int, int>>> edges(numberOfTiles);
+	for (int node = 0; node < clusters.numberOfNodes(); ++node) {
+		if (clusters.cell(node) < 0) {
+			continue;
+		}
+
+		for (const ClusterAbstraction::Edge& edge : clusters.edges(node)) {
+			edges[clusters.cell(node)].push_back(std::make_pair(clusters.cell(edge.target), edge.weight));
+		}
+		std::sort(edges[clusters.cell(node)].begin(), edges[clusters.cell(node)].end());
+	}
+
+	return edges;
+}
@@ -0,0 +1,152 @@
+#include "BreadthFirstSearch.h"
+#include "GridGraph.h"
+#include "JumpPointSearch.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <math.h>
+#include <memory>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_open_grid_expands_only_the_start();
+bool test_path_is_filled_cell_by_cell();
+bool test_unreachable_end_has_no_path();
+bool test_random_grids_match_breadth_first_search();
+bool test_eight_connected_random_grids_match_reference();
+
+// steps search to the end, returns pathCost of its parents
+double runSearch(JumpPointSearch& search, const GridGraph& graph, GridMovement movement);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 5;
+
+	TEST(test_open_grid_expands_only_the_start, errCount, okCount);
+	TEST(test_path_is_filled_cell_by_cell, errCount, okCount);
+	TEST(test_unreachable_end_has_no_path, errCount, okCount);
+	TEST(test_random_grids_match_breadth_first_search, errCount, okCount);
+	TEST(test_eight_connected_random_grids_match_reference, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_open_grid_expands_only_the_start() {
+	// width crosses a word boundary, so the horizontal jump reads two words
+	auto graph = std::make_shared<GridGraph>(130, 40);
+	graph->startNode() = graph->index(3, 5);
+	graph->endNode() = graph->index(120, 5);
+
+	JumpPointSearch search(graph, graph->numberOfNodes());
+	int expanded = 0;
+	while (search.step() != -1) {
+		++expanded;
+	}
+
+	return expanded == 1 && pathCost(*graph, search.parents(), GridMovement::FourConnected) == 117.0;
+}
+
+bool test_path_is_filled_cell_by_cell() {
+	// vertical wall on x = 5 with a gap on the last row
+	auto graph = std::make_shared<GridGraph>(10, 8);
+	for (int y = 0; y < 7; ++y) {
+		graph->setBlocked(5, y, true);
+	}
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(9, 0);
+
+	bool ok = true;
+	for (GridMovement movement : { GridMovement::FourConnected, GridMovement::EightConnected }) {
+		JumpPointSearch search(graph, graph->numberOfNodes(), movement);
+		double cost = runSearch(search, *graph, movement);
+		ok = ok && fabs(cost - referenceCost(*graph, movement)) < 1e-3;
+	}
+
+	return ok;
+}
+
+bool test_unreachable_end_has_no_path() {
+	auto graph = std::make_shared<GridGraph>(70, 6);
+	for (int y = 0; y < 6; ++y) {
+		graph->setBlocked(66, y, true);
+	}
+	graph->startNode() = graph->index(0, 3);
+	graph->endNode() = graph->index(69, 3);
+
+	JumpPointSearch search(graph, graph->numberOfNodes(), GridMovement::EightConnected);
+	while (search.step() != -1) {
+	}
+
+	return search.parents()[graph->endNode()] == -1;
+}
+
+bool test_random_grids_match_breadth_first_search() {
+	bool ok = true;
+	unsigned int seed = 1;
+	for (int width : { 7, 64, 65, 150 }) {
+		for (int obstaclePercent : { 0, 10, 30 }) {
+			for (int query = 0; query < 10; ++query) {
+				auto graph = createRandomGrid(width, 31, obstaclePercent, seed++);
+
+				BreadthFirstSearch reference(graph, graph->numberOfNodes());
+				while (reference.step() != -1) {
+				}
+				double expected = pathCost(*graph, reference.parents(), GridMovement::FourConnected);
+
+				JumpPointSearch search(graph, graph->numberOfNodes());
+				ok = ok && runSearch(search, *graph, GridMovement::FourConnected) == expected;
+			}
+		}
+	}
+
+	return ok;
+}
+
+bool test_eight_connected_random_grids_match_reference() {
+	bool ok = true;
+	unsigned int seed = 100;
+	for (int width : { 7, 64, 65, 150 }) {
+		for (int obstaclePercent : { 0, 10, 30 }) {
+			for (int query = 0; query < 10; ++query) {
+				auto graph = createRandomGrid(width, 31, obstaclePercent, seed++);
+				double expected = referenceCost(*graph, GridMovement::EightConnected);
+
+				JumpPointSearch search(graph, graph->numberOfNodes(), GridMovement::EightConnected);
+				ok = ok && fabs(runSearch(search, *graph, GridMovement::EightConnected) - expected) < 1e-3;
+			}
+		}
+	}
+
+	return ok;
+}
+
+double runSearch(JumpPointSearch& search, const GridGraph& graph, GridMovement movement) {
+	while (search.step() != -1) {
+	}
+
+	return pathCost(graph, search.parents(), movement);
+}
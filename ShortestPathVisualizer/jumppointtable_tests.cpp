@@ -0,0 +1,165 @@
+#include "GridGraph.h"
+#include "JumpPointSearch.h"
+#include "JumpPointTable.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <math.h>
+#include <memory>
+#include <sstream>
+#include <stdint.h>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_table_distances_on_small_map();
+bool test_table_save_and_load_round_trip();
+bool test_table_load_rejects_other_obstacles();
+bool test_longest_supported_side();
+bool test_random_grids_match_online_search();
+
+// steps search to the end, returns pathCost of its parents
+double runSearch(JumpPointSearch& search, const GridGraph& graph, GridMovement movement);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 5;
+
+	TEST(test_table_distances_on_small_map, errCount, okCount);
+	TEST(test_table_save_and_load_round_trip, errCount, okCount);
+	TEST(test_table_load_rejects_other_obstacles, errCount, okCount);
+	TEST(test_longest_supported_side, errCount, okCount);
+	TEST(test_random_grids_match_online_search, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_table_distances_on_small_map() {
+	// . . . . .
+	// . . . # .
+	// . . . . .
+	auto graph = std::make_shared<GridGraph>(5, 3);
+	graph->setBlocked(3, 1, true);
+
+	JumpPointTable table(graph, GridMovement::EightConnected);
+
+	int origin = graph->index(0, 0);
+	int middle = graph->index(0, 1);
+	return table.directionCount() == 8 &&
+		table.sizeInBytes() == 15 * 8 * sizeof(int16_t) &&
+		// (4, 0) has a forced neighbor below once the wall is passed
+		table.distance(origin, JumpPointTable::Right) == 4 &&
+		table.distance(origin, JumpPointTable::Left) == 0 &&
+		// the run on the middle row hits the wall after 2 cells
+		table.distance(middle, JumpPointTable::Right) == -2 &&
+		table.distance(origin, JumpPointTable::Down) == -2 &&
+		// the diagonal run stops at (2, 2), whose run to the right finds the jump point (4, 2)
+		table.distance(origin, JumpPointTable::DownRight) == 2;
+}
+
+bool test_table_save_and_load_round_trip() {
+	auto graph = createRandomGrid(100, 20, 20, 7);
+	JumpPointTable table(graph, GridMovement::EightConnected);
+
+	std::stringstream file;
+	bool saved = table.save(file);
+	std::shared_ptr<JumpPointTable> loaded = JumpPointTable::load(file, graph);
+
+	bool ok = saved && loaded != nullptr && loaded->movement() == GridMovement::EightConnected &&
+		loaded->sizeInBytes() == table.sizeInBytes();
+	for (int node = 0; ok && node < graph->numberOfNodes(); ++node) {
+		for (int direction = 0; direction < table.directionCount(); ++direction) {
+			ok = ok && loaded->distance(node, direction) == table.distance(node, direction);
+		}
+	}
+
+	return ok;
+}
+
+bool test_table_load_rejects_other_obstacles() {
+	auto graph = createRandomGrid(40, 20, 20, 8);
+	JumpPointTable table(graph, GridMovement::FourConnected);
+
+	std::stringstream file;
+	table.save(file);
+
+	auto changed = std::make_shared<GridGraph>(*graph);
+	changed->setBlocked(1, 1, !changed->isBlocked(1, 1));
+
+	std::stringstream truncated(file.str().substr(0, 20));
+
+	return !table.matches(*changed) && table.matches(*graph) &&
+		JumpPointTable::load(file, changed) == nullptr &&
+		JumpPointTable::load(truncated, graph) == nullptr;
+}
+
+bool test_longest_supported_side() {
+	// a free row of maxSide cells: the jump from one end hits the wall at the other end without wrapping
+	auto graph = std::make_shared<GridGraph>(JumpPointTable::maxSide, 1);
+	JumpPointTable table(graph, GridMovement::FourConnected);
+	std::stringstream file;
+	table.save(file);
+
+	auto tooWide = std::make_shared<GridGraph>(JumpPointTable::maxSide + 1, 1);
+	auto tooHigh = std::make_shared<GridGraph>(1, JumpPointTable::maxSide + 1);
+
+	return JumpPointTable::supports(*graph) && !JumpPointTable::supports(*tooWide) && !JumpPointTable::supports(*tooHigh) &&
+		table.distance(graph->index(0, 0), JumpPointTable::Right) == -(JumpPointTable::maxSide - 1) &&
+		table.distance(graph->index(JumpPointTable::maxSide - 1, 0), JumpPointTable::Left) == -(JumpPointTable::maxSide - 1) &&
+		JumpPointTable::load(file, tooWide) == nullptr;
+}
+
+bool test_random_grids_match_online_search() {
+	// JPS+ finds paths as short as the reference and the online jumps, in both movements
+	bool ok = true;
+	unsigned int seed = 200;
+	for (GridMovement movement : { GridMovement::FourConnected, GridMovement::EightConnected }) {
+		for (int width : { 7, 64, 65, 150 }) {
+			for (int obstaclePercent : { 0, 10, 30 }) {
+				for (int query = 0; query < 10; ++query) {
+					auto graph = createRandomGrid(width, 31, obstaclePercent, seed++);
+					double expected = referenceCost(*graph, movement);
+
+					JumpPointSearch online(graph, graph->numberOfNodes(), movement);
+					auto table = std::make_shared<JumpPointTable>(graph, movement);
+					JumpPointSearch plus(graph, table, graph->numberOfNodes());
+
+					ok = ok && fabs(runSearch(online, *graph, movement) - expected) < 1e-3 &&
+						fabs(runSearch(plus, *graph, movement) - expected) < 1e-3;
+				}
+			}
+		}
+	}
+
+	return ok;
+}
+
+double runSearch(JumpPointSearch& search, const GridGraph& graph, GridMovement movement) {
+	while (search.step() != -1) {
+	}
+
+	return pathCost(graph, search.parents(), movement);
+}
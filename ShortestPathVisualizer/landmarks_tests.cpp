@@ -0,0 +1,155 @@
+#include "AStar.h"
+#include "BucketQueue.h"
+#include "GridGraph.h"
+#include "Landmarks.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_farthest_picks_opposite_corners();
+bool test_bounds_never_overestimate();
+bool test_astar_with_landmarks_finds_shortest_paths();
+bool test_landmarks_cut_expansions_behind_walls();
+bool test_memory_per_landmark();
+bool test_unreachable_nodes_are_skipped();
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_farthest_picks_opposite_corners, errCount, okCount);
+	TEST(test_bounds_never_overestimate, errCount, okCount);
+	TEST(test_astar_with_landmarks_finds_shortest_paths, errCount, okCount);
+	TEST(test_landmarks_cut_expansions_behind_walls, errCount, okCount);
+	TEST(test_memory_per_landmark, errCount, okCount);
+	TEST(test_unreachable_nodes_are_skipped, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_farthest_picks_opposite_corners() {
+	auto graph = std::make_shared<GridGraph>(20, 10);
+	Landmarks landmarks(graph, 2, LandmarkSelection::Farthest);
+
+	// the farthest node from (0, 0) is (19, 9), and the farthest from that one is (0, 0)
+	return landmarks.landmarkCount() == 2 &&
+		landmarks.landmarks()[0] == graph->index(19, 9) &&
+		landmarks.landmarks()[1] == graph->index(0, 0) &&
+		landmarks.distance(0, graph->index(0, 0)) == 28 &&
+		landmarks.lowerBound(graph->index(0, 0), graph->index(19, 9)) == 28;
+}
+
+bool test_bounds_never_overestimate() {
+	bool ok = true;
+	unsigned int seed = 1;
+	for (LandmarkSelection selection : { LandmarkSelection::Farthest, LandmarkSelection::Avoid }) {
+		for (int obstaclePercent : { 0, 20, 35 }) {
+			auto graph = createRandomGrid(45, 25, obstaclePercent, seed++);
+			Landmarks landmarks(graph, 6, selection);
+
+			std::vector<int> distances = referenceDistances(*graph, graph->endNode());
+			for (int node = 0; node < graph->numberOfNodes(); ++node) {
+				if (distances[node] >= 0) {
+					ok = ok && landmarks.lowerBound(node, graph->endNode()) <= distances[node];
+				}
+			}
+		}
+	}
+
+	return ok;
+}
+
+bool test_astar_with_landmarks_finds_shortest_paths() {
+	bool ok = true;
+	unsigned int seed = 10;
+	for (int query = 0; query < 40; ++query) {
+		auto graph = createRandomGrid(70, 30, 30, seed++);
+		auto landmarks = std::make_shared<Landmarks>(graph, 1 + query % 8, query % 2 == 0 ? LandmarkSelection::Farthest : LandmarkSelection::Avoid);
+
+		AStar<BucketQueue> search(graph, graph->numberOfNodes(), ManhattanHeuristic(landmarks));
+		expandAll(search);
+
+		int expected = referenceDistances(*graph, graph->startNode())[graph->endNode()];
+		int length = 0;
+		int current = graph->endNode();
+		while (expected > 0 && current != graph->startNode() && current >= 0) {
+			current = search.parents()[current];
+			++length;
+		}
+
+		ok = ok && (expected <= 0 ? search.parents()[graph->endNode()] == -1 : length == expected && current == graph->startNode());
+	}
+
+	return ok;
+}
+
+bool test_landmarks_cut_expansions_behind_walls() {
+	// horizontal walls with the gap on alternate ends, start and end on opposite sides of every wall
+	auto graph = std::make_shared<GridGraph>(60, 41);
+	for (int y = 4, wall = 0; y < 40; y += 4, ++wall) {
+		for (int x = 0; x < 60; ++x) {
+			graph->setBlocked(x, y, x != (wall % 2 == 0 ? 59 : 0));
+		}
+	}
+	graph->startNode() = graph->index(30, 0);
+	graph->endNode() = graph->index(30, 40);
+
+	AStar<BucketQueue> manhattan(graph, graph->numberOfNodes());
+	AStar<BucketQueue> alt(graph, graph->numberOfNodes(), ManhattanHeuristic(std::make_shared<Landmarks>(graph, 4)));
+
+	return expandAll(alt) * 2 < expandAll(manhattan);
+}
+
+bool test_memory_per_landmark() {
+	auto graph = std::make_shared<GridGraph>(30, 20);
+	Landmarks landmarks(graph, 5, LandmarkSelection::Avoid);
+
+	return landmarks.landmarkCount() == 5 &&
+		landmarks.bytesPerLandmark() == 600 * sizeof(uint16_t) &&
+		landmarks.sizeInBytes() == 5 * landmarks.bytesPerLandmark() &&
+		landmarks.buildMilliseconds() >= 0.0;
+}
+
+bool test_unreachable_nodes_are_skipped() {
+	// the right column is cut off by a wall
+	auto graph = std::make_shared<GridGraph>(10, 5);
+	for (int y = 0; y < 5; ++y) {
+		graph->setBlocked(8, y, true);
+	}
+	Landmarks landmarks(graph, 3);
+
+	bool ok = true;
+	for (int landmark = 0; landmark < landmarks.landmarkCount(); ++landmark) {
+		ok = ok && landmarks.distance(landmark, graph->index(9, 2)) == Landmarks::unreachable;
+	}
+
+	return ok && landmarks.lowerBound(graph->index(9, 2), graph->index(0, 0)) == 0;
+}
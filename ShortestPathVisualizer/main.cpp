@@ -3,12 +3,24 @@
 #include <OpenGLWrapper.h>
 
 #include "AStar.h"
+#include "BucketQueue.h"
 #include "Button.h"
 #include "Camera.h"
+#include "ClusterAbstraction.h"
+#include "ContractionHierarchy.h"
+#include "ContractionHierarchyQuery.h"
+#include "DaryHeap.h"
 #include "Dijkstra.h"
-#include "Graph.h"
 #include "Grid.h"
+#include "GridGraph.h"
+#include "HierarchicalAStar.h"
 #include "IShortestPathStrategy.h"
+#include "JumpPointSearch.h"
+#include "JumpPointTable.h"
+#include "Landmarks.h"
+#include "RadixHeap.h"
+#include "SearchStatistics.h"
+#include "ShortestPathStrategyFactory.h"
 #include "WindowClickNotifier.h"
 
 
@@ -18,8 +30,8 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include <iostream>
-#include <list>
 #include <memory>
+#include <stdint.h>
 #include <string>
 #include <vector>
 
@@ -30,7 +42,9 @@ enum SelectingMode
 	ClearTile = 0,
 	StartTile = 1,
 	EndTile = 2,
-	BlockTile = 3
+	BlockTile = 3,
+	MudTile = 4,
+	WaterTile = 5
 };
 
 /************  END ENUMS  ***************/
@@ -45,6 +59,12 @@ const int gridYButtons = 17;
 
 const double secondsPerUpdate = 0.1f;
 
+const int landmarkCount = 4;	//landmarks used by A* when L is toggled on
+const int clusterSize = 7;		//tiles per side of the HPA* clusters when C is toggled on
+
+const int mudCost = 3;			//cost of entering a mud tile (clear tiles cost 1)
+const int waterCost = 8;		//cost of entering a water tile
+
 /***********  END CONSTS  ***************/
 
 /*************  GLOBALS  ****************/
@@ -62,6 +82,8 @@ std::shared_ptr<Button> btnClear;
 std::shared_ptr<Button> btnStart;
 std::shared_ptr<Button> btnEnd;
 std::shared_ptr<Button> btnBlock;
+std::shared_ptr<Button> btnMud;
+std::shared_ptr<Button> btnWater;
 
 std::shared_ptr<Button> btnBegin;
 
@@ -75,6 +97,10 @@ GLuint endTexture = 0;
 GLuint endClickedTexture = 0;
 GLuint blockTexture = 0;
 GLuint blockClickedTexture = 0;
+GLuint mudTexture = 0;
+GLuint mudClickedTexture = 0;
+GLuint waterTexture = 0;
+GLuint waterClickedTexture = 0;
 
 GLuint beginTexture = 0;
 GLuint beginClickedTexture = 0;
@@ -86,6 +112,12 @@ GLuint aStarNotClickedTexture = 0;
 GLuint aStarClickedTexture = 0;
 
 bool dijkstra = true;
+bool bidirectional = false;
+bool jumpPoints = false;
+bool useLandmarks = false;
+bool useHierarchy = false;
+bool useClusters = false;
+bool diagonalMoves = false;
 bool executing = false;
 bool isThereStartButton = false;
 bool isThereEndButton = false;
@@ -95,8 +127,16 @@ double elapsedTimeSinceLastUpdate = 0.0;
 SelectingMode selectingMode = SelectingMode::ClearTile;
 
 std::vector<std::vector<SelectingMode>> statusGrid;
-std::shared_ptr<Graph> graph;
+std::shared_ptr<GridGraph> graph;	//kept between runs, tiles are blocked and cleared on it when clicked
 std::unique_ptr<IShortestPathStrategy> shortestPathStrategy;
+//data computed from the blocked tiles, rebuilt only when the graph version changed since it was built
+std::shared_ptr<JumpPointTable> jumpPointTable;
+uint64_t jumpPointTableVersion = 0;
+std::shared_ptr<Landmarks> landmarks;
+uint64_t landmarksVersion = 0;
+std::shared_ptr<ContractionHierarchy> hierarchy;
+uint64_t hierarchyVersion = 0;
+std::shared_ptr<ClusterAbstraction> clusters;	//updated tile by tile instead
 
 /***********  END GLOBALS  **************/
 
@@ -104,6 +144,7 @@ std::unique_ptr<IShortestPathStrategy> shortestPathStrategy;
 /************  FUNCTIONS  ***************/
 void window_reshape_callback(GLFWwindow* window, int newWidth, int newHeight);
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
 void init(GLFWwindow*);
 void initStatusGrid();
 void resetGridTextures();
@@ -115,6 +156,8 @@ void createClearButton();
 void createStartButton();
 void createEndButton();
 void createBlockButton();
+void createMudButton();
+void createWaterButton();
 void createBeginButton();
 
 void update(GLFWwindow*, double dt);
@@ -128,11 +171,8 @@ void drawGrid(const Grid& grid, GLFWwindow* window);
 void getButtonXYFromIndex(int index, int& x, int& y);
 int getIndexFromXY(int x, int y);
 
-void initializeGraph();
-int getTopAdjacentButtonIndex(int x, int y);
-int getBottomAdjacentButtonIndex(int x, int y);
-int getLeftAdjacentButtonIndex(int x, int y);
-int getRightAdjacentButtonIndex(int x, int y);
+void setTileBlocked(int x, int y, bool blocked);
+int tileCost(SelectingMode mode);
 void drawPath(const std::vector<int>& parents);
 
 /**********  END FUNCTIONS  *************/
@@ -147,6 +187,8 @@ void onClearClick(Button*);
 void onStartClick(Button*);
 void onEndClick(Button*);
 void onBlockClick(Button*);
+void onMudClick(Button*);
+void onWaterClick(Button*);
 
 void onBeginClick(Button*);
 
@@ -229,6 +271,39 @@ void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
 	}
 }
 
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+	// B toggles searching from both ends at the same time (for Dijkstra and A*)
+	if (key == GLFW_KEY_B && action == GLFW_PRESS && !executing) {
+		bidirectional = !bidirectional;
+		std::cout << "Bidirectional search " << (bidirectional ? "on" : "off") << std::endl;
+	}
+	// J makes A* run as jump point search
+	else if (key == GLFW_KEY_J && action == GLFW_PRESS && !executing) {
+		jumpPoints = !jumpPoints;
+		std::cout << "Jump point search " << (jumpPoints ? "on" : "off") << std::endl;
+	}
+	// L gives A* landmark lower bounds (ALT) on top of the Manhattan distance
+	else if (key == GLFW_KEY_L && action == GLFW_PRESS && !executing) {
+		useLandmarks = !useLandmarks;
+		std::cout << "Landmarks " << (useLandmarks ? "on" : "off") << std::endl;
+	}
+	// H makes Dijkstra run on a contraction hierarchy of the grid
+	else if (key == GLFW_KEY_H && action == GLFW_PRESS && !executing) {
+		useHierarchy = !useHierarchy;
+		std::cout << "Contraction hierarchy " << (useHierarchy ? "on" : "off") << std::endl;
+	}
+	// C makes A* search the entrances between clusters of tiles first (HPA*)
+	else if (key == GLFW_KEY_C && action == GLFW_PRESS && !executing) {
+		useClusters = !useClusters;
+		std::cout << "Clusters " << (useClusters ? "on" : "off") << std::endl;
+	}
+	// E lets Dijkstra, A* and jump point search move diagonally (8-connected, never cutting the corner of a block)
+	else if (key == GLFW_KEY_E && action == GLFW_PRESS && !executing) {
+		diagonalMoves = !diagonalMoves;
+		std::cout << "Diagonal moves " << (diagonalMoves ? "on" : "off") << std::endl;
+	}
+}
+
 void init(GLFWwindow* window) {
 	//sets the clearing color
 	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
@@ -267,6 +342,8 @@ void init(GLFWwindow* window) {
 	createStartButton();
 	createEndButton();
 	createBlockButton();
+	createMudButton();
+	createWaterButton();
 
 	executing = false;
 	createBeginButton();
@@ -274,9 +351,25 @@ void init(GLFWwindow* window) {
 
 	//after creating everything set the mouse button callback in order to listen to clicks
 	glfwSetMouseButtonCallback(window, mouse_button_callback);
+	glfwSetKeyCallback(window, key_callback);
 }
 
 void initStatusGrid() {
+	if (graph == nullptr) {
+		graph = std::make_shared<GridGraph>(gridXButtons, gridYButtons);
+	}
+	else {
+		//the same graph is kept, only its blocked and terrain tiles are cleared
+		for (int y = 0; y != statusGrid.size(); ++y) {
+			for (int x = 0; x != statusGrid[y].size(); ++x) {
+				if (statusGrid[y][x] == SelectingMode::BlockTile) {
+					setTileBlocked(x, y, false);
+				}
+				graph->setCost(x, y, 1);
+			}
+		}
+	}
+
 	isThereStartButton = false;
 	isThereEndButton = false;
 	statusGrid = std::vector<std::vector<SelectingMode>>(gridYButtons, std::vector<SelectingMode>(gridXButtons, SelectingMode::ClearTile));
@@ -299,6 +392,12 @@ void createTextures() {
 	blockTexture = loadImage("Block.bmp");
 	blockClickedTexture = loadImage("Block_sel.bmp");
 
+	mudTexture = loadImage("Mud.bmp");
+	mudClickedTexture = loadImage("Mud_sel.bmp");
+
+	waterTexture = loadImage("Water.bmp");
+	waterClickedTexture = loadImage("Water_sel.bmp");
+
 	beginTexture = loadImage("Begin.bmp");
 	beginClickedTexture = loadImage("Begin_sel.bmp");
 
@@ -351,6 +450,18 @@ void createBlockButton() {
 	btnBlock->addClickListener(onBlockClick);
 }
 
+void createMudButton() {
+	btnMud = std::make_shared<Button>(mudTexture, 0.3f, 0.03f, 30.0f, 30.0f);
+	windowClickNotifier->addObserver(btnMud);
+	btnMud->addClickListener(onMudClick);
+}
+
+void createWaterButton() {
+	btnWater = std::make_shared<Button>(waterTexture, 0.35f, 0.03f, 30.0f, 30.0f);
+	windowClickNotifier->addObserver(btnWater);
+	btnWater->addClickListener(onWaterClick);
+}
+
 void createBeginButton() {
 	btnBegin = std::make_shared<Button>(beginTexture, 0.7f, 0.03f, 30.0f, 30.0f);
 	windowClickNotifier->addObserver(btnBegin);
@@ -362,6 +473,9 @@ void update(GLFWwindow*, double dt) {
 		int step = shortestPathStrategy->step();
 		if (step == -1) {
 			drawPath(shortestPathStrategy->parents());
+			if (SearchStatistics::enabled()) {
+				printStatistics(std::cout, shortestPathStrategy->statistics());
+			}
 			shortestPathStrategy = nullptr;
 			executing = false;
 			btnBegin->texture() = beginTexture;
@@ -385,6 +499,8 @@ void display(GLFWwindow* window, double dt) {
 	drawButton(*btnStart, window, btnStart->position().x, btnStart->position().y);
 	drawButton(*btnEnd, window, btnEnd->position().x, btnEnd->position().y);
 	drawButton(*btnBlock, window, btnBlock->position().x, btnBlock->position().y);
+	drawButton(*btnMud, window, btnMud->position().x, btnMud->position().y);
+	drawButton(*btnWater, window, btnWater->position().x, btnWater->position().y);
 
 	drawButton(*btnDijkstra, window, btnDijkstra->position().x, btnDijkstra->position().y);
 	drawButton(*btnAStar, window, btnAStar->position().x, btnAStar->position().y);
@@ -540,6 +656,8 @@ void onGridClicked(Button* button) {
 			isThereEndButton = false;
 		}
 
+		setTileBlocked(x, y, selectingMode == SelectingMode::BlockTile);
+		graph->setCost(x, y, tileCost(selectingMode));
 		statusGrid[y][x] = selectingMode;
 
 		switch (selectingMode)
@@ -550,14 +668,22 @@ void onGridClicked(Button* button) {
 		case StartTile:
 			button->texture() = startTexture;
 			isThereStartButton = true;
+			graph->startNode() = button->index();
 			break;
 		case EndTile:
 			button->texture() = endTexture;
 			isThereEndButton = true;
+			graph->endNode() = button->index();
 			break;
 		case BlockTile:
 			button->texture() = blockTexture;
 			break;
+		case MudTile:
+			button->texture() = mudTexture;
+			break;
+		case WaterTile:
+			button->texture() = waterTexture;
+			break;
 		default:
 			std::cout << "Should never enter here" << std::endl;
 			break;
@@ -573,6 +699,8 @@ void onClearClick(Button* button) {
 		btnStart->texture() = startTexture;
 		btnEnd->texture() = endTexture;
 		btnBlock->texture() = blockTexture;
+		btnMud->texture() = mudTexture;
+		btnWater->texture() = waterTexture;
 	}
 }
 
@@ -584,6 +712,8 @@ void onStartClick(Button* button) {
 		btnStart->texture() = startClickedTexture;
 		btnEnd->texture() = endTexture;
 		btnBlock->texture() = blockTexture;
+		btnMud->texture() = mudTexture;
+		btnWater->texture() = waterTexture;
 	}
 }
 
@@ -595,6 +725,8 @@ void onEndClick(Button* button) {
 		btnStart->texture() = startTexture;
 		btnEnd->texture() = endClickedTexture;
 		btnBlock->texture() = blockTexture;
+		btnMud->texture() = mudTexture;
+		btnWater->texture() = waterTexture;
 	}
 }
 
@@ -606,6 +738,34 @@ void onBlockClick(Button* button) {
 		btnStart->texture() = startTexture;
 		btnEnd->texture() = endTexture;
 		btnBlock->texture() = blockClickedTexture;
+		btnMud->texture() = mudTexture;
+		btnWater->texture() = waterTexture;
+	}
+}
+
+void onMudClick(Button* button) {
+	if (!executing && selectingMode != SelectingMode::MudTile) {
+		selectingMode = SelectingMode::MudTile;
+
+		btnClear->texture() = whiteTexture;
+		btnStart->texture() = startTexture;
+		btnEnd->texture() = endTexture;
+		btnBlock->texture() = blockTexture;
+		btnMud->texture() = mudClickedTexture;
+		btnWater->texture() = waterTexture;
+	}
+}
+
+void onWaterClick(Button* button) {
+	if (!executing && selectingMode != SelectingMode::WaterTile) {
+		selectingMode = SelectingMode::WaterTile;
+
+		btnClear->texture() = whiteTexture;
+		btnStart->texture() = startTexture;
+		btnEnd->texture() = endTexture;
+		btnBlock->texture() = blockTexture;
+		btnMud->texture() = mudTexture;
+		btnWater->texture() = waterClickedTexture;
 	}
 }
 
@@ -616,109 +776,115 @@ void onBeginClick(Button* button) {
 		executing = true;
 		button->texture() = beginClickedTexture;
 
-		initializeGraph();
-		if (dijkstra) {
-			shortestPathStrategy.reset(new Dijkstra(graph, gridXButtons * gridYButtons));
+		// the factory picks the implementation (while every tile costs 1 Dijkstra runs as a BFS,
+		// with mud or water it follows the tile costs and the searches that only know unit moves are skipped)
+		bool weighted = !graph->hasUniformEdgeWeights();
+		if (weighted && (bidirectional || jumpPoints || useHierarchy || useClusters)) {
+			std::cout << "Terrain costs: bidirectional, jump point, hierarchy and cluster searches are off" << std::endl;
 		}
-		else{
-
-			shortestPathStrategy.reset(new AStar(graph, gridXButtons * gridYButtons));
+		if (diagonalMoves && (bidirectional || useLandmarks || useHierarchy || useClusters)) {
+			std::cout << "Diagonal moves: bidirectional, landmark, hierarchy and cluster searches are off" << std::endl;
 		}
-	}
-}
-
-void getButtonXYFromIndex(int index, int& x, int& y) {
-	x = index % gridXButtons;
-	y = index / gridXButtons;
-}
-
-int getIndexFromXY(int x, int y) {
-	return x + y * gridXButtons;
-}
-
-void initializeGraph() {
-	graph.reset(new Graph(gridXButtons * gridYButtons));
 
-	for (int y = 0; y != statusGrid.size(); ++y) {
-		const auto& row = statusGrid[y];
-		for (int x = 0; x != row.size(); ++x) {
-			//int index = getIndexFromXY(x, y);
-			int index = graph->nodes().size(); // index equals the position where the node is going to be added
-			Graph::Node node = { index, x, y, -1 };
-			//add node to graph
-			graph->nodes().push_back(node);
-			graph->adjacencyList().push_back(std::list<int>());
+		ShortestPathAlgorithm algorithm = dijkstra ? ShortestPathAlgorithm::Dijkstra : ShortestPathAlgorithm::AStar;
+		if (bidirectional) {
+			algorithm = dijkstra ? ShortestPathAlgorithm::BidirectionalDijkstra : ShortestPathAlgorithm::BidirectionalAStar;
+		}
+		else if (jumpPoints && !dijkstra) {
+			algorithm = ShortestPathAlgorithm::JumpPointSearch;
+		}
 
-			//if this node is a block don't add adjacency
-			if (row[x] == SelectingMode::BlockTile) {
-				continue;
+		if (algorithm == ShortestPathAlgorithm::JumpPointSearch && !weighted) {
+			// JPS+: the jump table only depends on the blocks, so it is reused until they change
+			GridMovement movement = diagonalMoves ? GridMovement::EightConnected : GridMovement::FourConnected;
+			if (jumpPointTable == nullptr || jumpPointTableVersion != graph->version() || jumpPointTable->movement() != movement) {
+				jumpPointTable = std::make_shared<JumpPointTable>(graph, movement);
+				jumpPointTableVersion = graph->version();
+				std::cout << "Jump point table built in " << jumpPointTable->buildMilliseconds() << " ms ("
+					<< jumpPointTable->sizeInBytes() << " bytes)" << std::endl;
 			}
-
-			//add adjacency nodes
-			int topAdjacent = getTopAdjacentButtonIndex(x, y);
-			if (topAdjacent >= 0) {
-				graph->adjacencyList()[index].push_back(topAdjacent);
+			shortestPathStrategy = std::unique_ptr<IShortestPathStrategy>(new JumpPointSearch(graph, jumpPointTable, gridXButtons * gridYButtons));
+		}
+		else if (diagonalMoves) {
+			// the other options only know the 4 straight moves
+			if (dijkstra) {
+				shortestPathStrategy = std::unique_ptr<IShortestPathStrategy>(new OctileDijkstra<>(graph, gridXButtons * gridYButtons));
 			}
-
-			int bottomAdjacent = getBottomAdjacentButtonIndex(x, y);
-			if (bottomAdjacent >= 0) {
-				graph->adjacencyList()[index].push_back(bottomAdjacent);
+			else {
+				shortestPathStrategy = std::unique_ptr<IShortestPathStrategy>(new OctileAStar<>(graph, gridXButtons * gridYButtons));
 			}
-
-			int leftAdjacent = getLeftAdjacentButtonIndex(x, y);
-			if (leftAdjacent >= 0) {
-				graph->adjacencyList()[index].push_back(leftAdjacent);
+		}
+		else if (algorithm == ShortestPathAlgorithm::Dijkstra && useHierarchy && !weighted) {
+			if (hierarchy == nullptr || hierarchyVersion != graph->version()) {
+				hierarchy = std::make_shared<ContractionHierarchy>(graph);
+				hierarchyVersion = graph->version();
+				std::cout << "Contraction hierarchy built in " << hierarchy->buildMilliseconds() << " ms ("
+					<< hierarchy->numberOfShortcuts() << " shortcuts)" << std::endl;
 			}
-
-			int rightAdjacent = getRightAdjacentButtonIndex(x, y);
-			if (rightAdjacent >= 0) {
-				graph->adjacencyList()[index].push_back(rightAdjacent);
+			shortestPathStrategy = std::unique_ptr<IShortestPathStrategy>(new ContractionHierarchyQuery(graph, hierarchy, gridXButtons * gridYButtons));
+		}
+		else if (algorithm == ShortestPathAlgorithm::AStar && useClusters && !weighted) {
+			// only the clusters around the tiles that changed since the last run are recomputed
+			if (clusters == nullptr) {
+				clusters = std::make_shared<ClusterAbstraction>(graph, clusterSize);
+				std::cout << "Clusters built in " << clusters->buildMilliseconds() << " ms ("
+					<< clusters->numberOfEntrances() << " entrances)" << std::endl;
 			}
-
-			//check if this node is start or end one
-			if (row[x] == SelectingMode::StartTile) {
-				graph->startNode() = index;
+			else {
+				int updated = clusters->update();
+				std::cout << updated << " clusters updated in " << clusters->updateMilliseconds() << " ms" << std::endl;
 			}
-			else if (row[x] == SelectingMode::EndTile) {
-				graph->endNode() = index;
+			shortestPathStrategy = std::unique_ptr<IShortestPathStrategy>(new HierarchicalAStar(graph, clusters, gridXButtons * gridYButtons));
+		}
+		else if (algorithm == ShortestPathAlgorithm::AStar && useLandmarks) {
+			if (landmarks == nullptr || landmarksVersion != graph->version()) {
+				landmarks = std::make_shared<Landmarks>(graph, landmarkCount);
+				landmarksVersion = graph->version();
+				std::cout << "Landmarks selected in " << landmarks->buildMilliseconds() << " ms ("
+					<< landmarks->bytesPerLandmark() << " bytes per landmark)" << std::endl;
+			}
+			//the landmark distances count moves, the heuristic scales them by the cheapest tile
+			if (weighted) {
+				shortestPathStrategy = std::unique_ptr<IShortestPathStrategy>(new WeightedAStar<RadixHeap>(graph, gridXButtons * gridYButtons, ManhattanHeuristic(landmarks)));
+			}
+			else {
+				shortestPathStrategy = std::unique_ptr<IShortestPathStrategy>(new AStar<BucketQueue>(graph, gridXButtons * gridYButtons, ManhattanHeuristic(landmarks)));
 			}
 		}
+		else {
+			shortestPathStrategy = ShortestPathStrategyFactory::create(algorithm, graph, gridXButtons * gridYButtons);
+		}
 	}
 }
 
-int getTopAdjacentButtonIndex(int x, int y) {
-	if (y <= 0 || statusGrid[y - 1][x] == SelectingMode::BlockTile) {
-		return -1;
-	}
-	else {
-		return getIndexFromXY(x, y - 1);
-	}
+void getButtonXYFromIndex(int index, int& x, int& y) {
+	x = index % gridXButtons;
+	y = index / gridXButtons;
 }
 
-int getBottomAdjacentButtonIndex(int x, int y) {
-	if ((y+1) >=gridYButtons || statusGrid[y + 1][x] == SelectingMode::BlockTile) {
-		return -1;
-	}
-	else {
-		return getIndexFromXY(x, y + 1);
-	}
+int getIndexFromXY(int x, int y) {
+	return x + y * gridXButtons;
 }
 
-int getLeftAdjacentButtonIndex(int x, int y) {
-	if (x <= 0 || statusGrid[y][x-1] == SelectingMode::BlockTile) {
-		return -1;
-	}
-	else {
-		return getIndexFromXY(x-1, y);
+void setTileBlocked(int x, int y, bool blocked) {
+	uint64_t version = graph->version();
+	graph->setBlocked(x, y, blocked);
+
+	//only the clusters around the tile are recomputed by the next run
+	if (clusters != nullptr && graph->version() != version) {
+		clusters->invalidate(x, y);
 	}
 }
 
-int getRightAdjacentButtonIndex(int x, int y) {
-	if ((x+1) >= gridXButtons || statusGrid[y][x + 1] == SelectingMode::BlockTile) {
-		return -1;
-	}
-	else {
-		return getIndexFromXY(x + 1, y);
+int tileCost(SelectingMode mode) {
+	switch (mode)
+	{
+	case MudTile:
+		return mudCost;
+	case WaterTile:
+		return waterCost;
+	default:
+		return 1;
 	}
 }
 
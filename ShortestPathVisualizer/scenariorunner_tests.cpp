@@ -0,0 +1,220 @@
+#include "GridGraph.h"
+#include "ScenarioRunner.h"
+#include "ShortestPathStrategyFactory.h"
+#include "TestGrids.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_path_length_counts_diagonals();
+bool test_scenarios_match_reference_lengths();
+bool test_wrong_lengths_are_not_optimal();
+bool test_summary_percentiles_and_buckets();
+
+// octile distances in double from (x, y), diagonals can't cut corners (-1 when unreachable)
+std::vector<double> referenceDistances(const GridGraph& graph, int x, int y);
+Scenario makeScenario(int bucket, int startX, int startY, int endX, int endY, double optimalLength);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 4;
+
+	TEST(test_path_length_counts_diagonals, errCount, okCount);
+	TEST(test_scenarios_match_reference_lengths, errCount, okCount);
+	TEST(test_wrong_lengths_are_not_optimal, errCount, okCount);
+	TEST(test_summary_percentiles_and_buckets, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_path_length_counts_diagonals() {
+	GridGraph graph(4, 4);
+	graph.setCost(2, 2, 3);
+
+	// right, diagonal into the cell of cost 3, down
+	std::vector<int> path = { graph.index(0, 1), graph.index(1, 1), graph.index(2, 2), graph.index(2, 3) };
+	double length = ScenarioRunner::pathLength(graph, path);
+
+	return std::abs(length - (2.0 + 3.0 * std::sqrt(2.0))) < 1e-12 && ScenarioRunner::pathLength(graph, { graph.index(3, 3) }) == 0.0;
+}
+
+bool test_scenarios_match_reference_lengths() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 5 && ok; ++seed) {
+		auto graph = createRandomObstacles(60, 40, 30, seed);
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<int> cell(0, graph->numberOfNodes() - 1);
+
+		std::vector<Scenario> scenarios;
+		while (scenarios.size() < 20) {
+			int start = cell(random);
+			int end = cell(random);
+			int startX = start % graph->width();
+			int startY = start / graph->width();
+			std::vector<double> distances = referenceDistances(*graph, startX, startY);
+			if (distances[end] >= 0.0) {
+				scenarios.push_back(makeScenario(static_cast<int>(distances[end] / 4.0), startX, startY, end % graph->width(), end / graph->width(),
+					distances[end]));
+			}
+		}
+
+		for (ShortestPathAlgorithm algorithm : { ShortestPathAlgorithm::Dijkstra, ShortestPathAlgorithm::AStar }) {
+			ScenarioRunner runner(graph, algorithm);
+			std::vector<ScenarioResult> results = runner.run(scenarios);
+			ok = ok && results.size() == scenarios.size() && ScenarioRunner::summarize(scenarios, results).notOptimal == 0;
+		}
+	}
+
+	return ok;
+}
+
+bool test_wrong_lengths_are_not_optimal() {
+	// (4, 0) can only be reached around the wall at the bottom, without cutting its corner
+	auto graph = std::make_shared<GridGraph>(7, 5);
+	for (int y = 0; y < 4; ++y) {
+		graph->setBlocked(2, y, true);
+	}
+	// the corner (6, 4) is walled in
+	graph->setBlocked(5, 4, true);
+	graph->setBlocked(6, 3, true);
+
+	double around = 8.0 + 2.0 * std::sqrt(2.0);
+	std::vector<Scenario> scenarios = {
+		makeScenario(0, 0, 0, 4, 0, around),
+		makeScenario(0, 0, 0, 4, 0, around + 0.5),
+		makeScenario(0, 0, 0, 6, 4, 8.0)
+	};
+
+	ScenarioRunner runner(graph, ShortestPathAlgorithm::AStar);
+	std::vector<ScenarioResult> results = runner.run(scenarios);
+
+	return std::abs(referenceDistances(*graph, 0, 0)[graph->index(4, 0)] - around) < 1e-9 && results[0].optimal &&
+		!results[1].optimal && results[1].length == results[0].length && !results[2].optimal && results[2].length < 0.0 &&
+		ScenarioRunner::summarize(scenarios, results).notOptimal == 2;
+}
+
+bool test_summary_percentiles_and_buckets() {
+	std::vector<Scenario> scenarios;
+	std::vector<ScenarioResult> results;
+	for (int i = 0; i < 100; ++i) {
+		// bucket 0 gets the odd scenarios, bucket 2 the even ones, latencies 1 to 100 ms in reverse
+		scenarios.push_back(makeScenario(i % 2 == 0 ? 2 : 0, 0, 0, 0, 0, 0.0));
+		ScenarioResult result;
+		result.length = 0.0;
+		result.expansions = static_cast<size_t>(i);
+		result.milliseconds = 100.0 - i;
+		result.optimal = i != 7;
+		results.push_back(result);
+	}
+
+	ScenarioSummary summary = ScenarioRunner::summarize(scenarios, results);
+	ScenarioSummary empty = ScenarioRunner::summarize({}, {});
+
+	// 5050 ms for 100 scenarios
+	return summary.scenarios == 100 && summary.notOptimal == 1 && summary.p50Milliseconds == 50.0 && summary.p99Milliseconds == 99.0 &&
+		std::abs(summary.queriesPerSecond - 100000.0 / 5050.0) < 1e-9 && summary.buckets.size() == 2 &&
+		summary.buckets[0].bucket == 0 && summary.buckets[0].scenarios == 50 && summary.buckets[0].meanExpansions == 50.0 &&
+		summary.buckets[0].meanMilliseconds == 50.0 && summary.buckets[1].bucket == 2 && summary.buckets[1].meanExpansions == 49.0 &&
+		empty.scenarios == 0 && empty.buckets.empty();
+}
+
+std::vector<double> referenceDistances(const GridGraph& graph, int x, int y) {
+	auto isFree = [&graph](int cellX, int cellY) {
+		return cellX >= 0 && cellX < graph.width() && cellY >= 0 && cellY < graph.height() && !graph.isBlocked(cellX, cellY);
+	};
+
+	const double unreached = std::numeric_limits<double>::max();
+	std::vector<double> distances(graph.numberOfNodes(), unreached);
+	if (!isFree(x, y)) {
+		std::fill(distances.begin(), distances.end(), -1.0);
+		return distances;
+	}
+
+	typedef std::pair<double, int> Entry;
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+	distances[graph.index(x, y)] = 0.0;
+	queue.push(Entry(0.0, graph.index(x, y)));
+	while (!queue.empty()) {
+		Entry entry = queue.top();
+		queue.pop();
+		if (entry.first > distances[entry.second]) {
+			continue;
+		}
+
+		int fromX = 0;
+		int fromY = 0;
+		graph.coordinates(entry.second, fromX, fromY);
+		for (int dy = -1; dy <= 1; ++dy) {
+			for (int dx = -1; dx <= 1; ++dx) {
+				bool diagonal = dx != 0 && dy != 0;
+				if ((dx == 0 && dy == 0) || !isFree(fromX + dx, fromY + dy) ||
+					(diagonal && (!isFree(fromX + dx, fromY) || !isFree(fromX, fromY + dy)))) {
+					continue;
+				}
+
+				int to = graph.index(fromX + dx, fromY + dy);
+				double distance = entry.first + (diagonal ? std::sqrt(2.0) : 1.0);
+				if (distance < distances[to]) {
+					distances[to] = distance;
+					queue.push(Entry(distance, to));
+				}
+			}
+		}
+	}
+
+	for (double& distance : distances) {
+		if (distance == unreached) {
+			distance = -1.0;
+		}
+	}
+
+	return distances;
+}
+
+Scenario makeScenario(int bucket, int startX, int startY, int endX, int endY, double optimalLength) {
+	Scenario scenario;
+	scenario.bucket = bucket;
+	scenario.map = "test.map";
+	scenario.mapWidth = 0;
+	scenario.mapHeight = 0;
+	scenario.query.startX = startX;
+	scenario.query.startY = startY;
+	scenario.query.endX = endX;
+	scenario.query.endY = endY;
+	scenario.optimalLength = optimalLength;
+
+	return scenario;
+}
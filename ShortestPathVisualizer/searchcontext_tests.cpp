@@ -0,0 +1,210 @@
+#include "AStar.h"
+#include "BucketQueue.h"
+#include "DaryHeap.h"
+#include "Dijkstra.h"
+#include "GridGraph.h"
+#include "RadixHeap.h"
+#include "SearchContext.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_new_context_has_nothing_reached();
+bool test_reset_forgets_the_last_search();
+bool test_closed_nodes_stay_reached();
+bool test_reused_dijkstra_matches_fresh_searches();
+bool test_reused_astar_matches_fresh_searches();
+bool test_borrowed_search_leaves_parents_empty();
+bool test_small_cost_slots_survive_wraparound();
+
+// runs search to the end, the end node is found in parents (fresh search) or in the context
+template<class Search>
+void runToEnd(Search& search);
+// number of tiles from the end back to the start following parent, -1 if the end was not reached
+template<class Parent>
+int pathLength(const GridGraph& graph, Parent parent);
+// random start and end pairs searched with a fresh search and with one reused context
+template<template<class> class Search, class PriorityQueue>
+bool reusedMatchesFresh(unsigned int seed);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 7;
+
+	TEST(test_new_context_has_nothing_reached, errCount, okCount);
+	TEST(test_reset_forgets_the_last_search, errCount, okCount);
+	TEST(test_closed_nodes_stay_reached, errCount, okCount);
+	TEST(test_reused_dijkstra_matches_fresh_searches, errCount, okCount);
+	TEST(test_reused_astar_matches_fresh_searches, errCount, okCount);
+	TEST(test_borrowed_search_leaves_parents_empty, errCount, okCount);
+	TEST(test_small_cost_slots_survive_wraparound, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_new_context_has_nothing_reached() {
+	SearchContext<> context(10);
+
+	bool ok = context.capacity() == 10 && context.queue().isEmpty();
+	for (int node = 0; node < 10; ++node) {
+		ok = ok && !context.isReached(node) && !context.isClosed(node) && context.distance(node) == -1.0f && context.parent(node) == -1;
+	}
+
+	return ok;
+}
+
+bool test_reset_forgets_the_last_search() {
+	SearchContext<BucketQueue> context(10);
+	context.reach(3, 2.0f, 1);
+	context.reach(4, 3.0f, 3);
+	context.close(3);
+	context.queue().insert(4, 3.0f);
+
+	bool ok = context.isReached(3) && context.distance(4) == 3.0f && context.parent(4) == 3;
+
+	context.reset();
+	ok = ok && !context.isReached(3) && !context.isClosed(3) && context.distance(4) == -1.0f && context.parent(4) == -1;
+	ok = ok && context.queue().isEmpty();
+
+	// the node left in the queue can be inserted again
+	context.reach(4, 1.0f, 0);
+	context.queue().insert(4, 1.0f);
+	return ok && context.queue().top() == 4 && context.distance(4) == 1.0f;
+}
+
+bool test_closed_nodes_stay_reached() {
+	SearchContext<> context(4);
+	context.reach(2, 5.0f, 1);
+
+	bool ok = context.isReached(2) && !context.isClosed(2);
+	context.close(2);
+	return ok && context.isReached(2) && context.isClosed(2) && context.distance(2) == 5.0f && context.parent(2) == 1;
+}
+
+bool test_reused_dijkstra_matches_fresh_searches() {
+	return reusedMatchesFresh<Dijkstra, DaryHeap<4>>(1) && reusedMatchesFresh<Dijkstra, BucketQueue>(2) &&
+		reusedMatchesFresh<Dijkstra, RadixHeap>(3);
+}
+
+bool test_reused_astar_matches_fresh_searches() {
+	return reusedMatchesFresh<AStar, DaryHeap<2>>(4) && reusedMatchesFresh<AStar, BucketQueue>(5) &&
+		reusedMatchesFresh<AStar, RadixHeap>(6);
+}
+
+bool test_borrowed_search_leaves_parents_empty() {
+	auto graph = std::make_shared<GridGraph>(8, 8);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(7, 7);
+
+	SearchContext<BucketQueue> context(graph->numberOfNodes());
+	AStar<BucketQueue> search(graph, context);
+	runToEnd(search);
+
+	return search.parents().empty() && pathLength(*graph, [&](int node) { return context.parent(node); }) == 14;
+}
+
+bool test_small_cost_slots_survive_wraparound() {
+	SearchContext<BucketQueue, uint16_t> context(10);
+	bool ok = SearchContext<BucketQueue, uint16_t>::bytesPerNode() < SearchContext<BucketQueue, uint32_t>::bytesPerNode();
+
+	// the uint16_t stamps wrap around twice, nodes of older searches must never look reached
+	for (int search = 0; search < 70000 && ok; ++search) {
+		int node = search % 10;
+		context.reach(node, static_cast<uint16_t>(search % 1000), node - 1);
+		if (search % 3 == 0) {
+			context.close(node);
+		}
+		ok = context.isReached(node) && context.distance(node) == search % 1000;
+
+		context.reset();
+		for (int other = 0; other < 10 && ok; ++other) {
+			ok = !context.isReached(other) && !context.isClosed(other) && context.distance(other) == UINT16_MAX;
+		}
+	}
+
+	return ok;
+}
+
+template<template<class> class Search, class PriorityQueue>
+bool reusedMatchesFresh(unsigned int seed) {
+	auto graph = createRandomObstacles(40, 30, 25, seed);
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<int> cell(0, graph->numberOfNodes() - 1);
+
+	SearchContext<PriorityQueue> context(graph->numberOfNodes());
+	bool ok = true;
+	for (int query = 0; query < 200 && ok; ++query) {
+		graph->startNode() = cell(random);
+		graph->endNode() = cell(random);
+		int x = 0;
+		int y = 0;
+		graph->coordinates(graph->startNode(), x, y);
+		graph->setBlocked(x, y, false);
+		graph->coordinates(graph->endNode(), x, y);
+		graph->setBlocked(x, y, false);
+
+		Search<PriorityQueue> fresh(graph, graph->numberOfNodes());
+		runToEnd(fresh);
+		int expected = pathLength(*graph, [&](int node) { return fresh.parents()[node]; });
+
+		Search<PriorityQueue> reused(graph, context);
+		runToEnd(reused);
+		int length = pathLength(*graph, [&](int node) { return context.parent(node); });
+
+		ok = length == expected && (expected < 0 || context.distance(graph->endNode()) == static_cast<float>(expected));
+	}
+
+	return ok;
+}
+
+template<class Search>
+void runToEnd(Search& search) {
+	while (search.step() != -1) {
+	}
+}
+
+template<class Parent>
+int pathLength(const GridGraph& graph, Parent parent) {
+	if (graph.startNode() == graph.endNode()) {
+		return 0;
+	}
+
+	int length = 0;
+	for (int node = graph.endNode(); node != graph.startNode(); node = parent(node)) {
+		if (node < 0) {
+			return -1;
+		}
+		++length;
+	}
+
+	return length;
+}
@@ -0,0 +1,217 @@
+#include "AStar.h"
+#include "BestFirstSearch.h"
+#include "DaryHeap.h"
+#include "Dijkstra.h"
+#include "GridGraph.h"
+#include "IShortestPathStrategy.h"
+#include "SearchPolicies.h"
+#include "SearchStatistics.h"
+#include "ShortestPathStrategyFactory.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  TYPES  *****************/
+
+// inconsistent on purpose: node 1 looks 5 moves farther from the end than it is
+class BumpHeuristic
+{
+public:
+	template<class Graph>
+	void target(const Graph&, int) {
+	}
+
+	template<class Cost, class Graph>
+	Cost estimate(const Graph&, int node)const {
+		return node == 1 ? Cost(5) : Cost(0);
+	}
+};
+
+/**********  END TYPES  ***************/
+
+/************  FUNCTIONS  ***************/
+
+// The counters are only there when the tests are built with SHORTEST_PATH_STATISTICS,
+// without it every test checks that all of them stay 0.
+bool test_counters_follow_the_steps();
+bool test_solve_counts_like_step();
+bool test_inconsistent_heuristic_reopens();
+bool test_every_strategy_counts_expansions();
+bool test_sum_keeps_largest_queue();
+
+// random obstacles, the start and end at opposite corners
+std::shared_ptr<GridGraph> createCornerToCornerGrid(int width, int height, int obstaclePercent, unsigned int seed);
+bool isZero(const SearchStatistics& statistics);
+// the counters that don't depend on time are the same
+bool sameCounters(const SearchStatistics& first, const SearchStatistics& second);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 5;
+
+	std::cout << "Statistics " << (SearchStatistics::enabled() ? "enabled" : "disabled") << std::endl;
+
+	TEST(test_counters_follow_the_steps, errCount, okCount);
+	TEST(test_solve_counts_like_step, errCount, okCount);
+	TEST(test_inconsistent_heuristic_reopens, errCount, okCount);
+	TEST(test_every_strategy_counts_expansions, errCount, okCount);
+	TEST(test_sum_keeps_largest_queue, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_counters_follow_the_steps() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 5 && ok; ++seed) {
+		auto graph = createCornerToCornerGrid(40, 30, 20, seed);
+
+		GridAStar<> search(graph, graph->numberOfNodes());
+		size_t steps = 0;
+		while (search.step() != -1) {
+			++steps;
+		}
+		bool found = search.solve().distance >= 0.0f;
+		SearchStatistics statistics = search.statistics();
+
+		if (!SearchStatistics::enabled()) {
+			ok = isZero(statistics);
+			continue;
+		}
+
+		// every reached node was inserted once, the end is popped but not expanded
+		size_t reached = 0;
+		for (int node = 0; node < graph->numberOfNodes(); ++node) {
+			if (node == graph->startNode() || search.parents()[node] >= 0) {
+				++reached;
+			}
+		}
+		ok = statistics.expanded == steps && statistics.pops == steps + (found ? 1 : 0) && statistics.inserts == reached &&
+			statistics.generated >= statistics.expanded && statistics.maxQueueSize > 0 && statistics.maxQueueSize <= reached &&
+			statistics.reopenings == 0 && statistics.expansionMilliseconds >= 0.0 && statistics.queueMilliseconds >= 0.0;
+	}
+
+	return ok;
+}
+
+bool test_solve_counts_like_step() {
+	auto graph = createCornerToCornerGrid(50, 50, 25, 7);
+
+	Dijkstra<> stepped(graph, graph->numberOfNodes());
+	while (stepped.step() != -1) {
+	}
+	Dijkstra<> solved(graph, graph->numberOfNodes());
+	solved.solve();
+
+	return sameCounters(stepped.statistics(), solved.statistics()) && (SearchStatistics::enabled() || isZero(solved.statistics()));
+}
+
+bool test_inconsistent_heuristic_reopens() {
+	// two rows, (1, 0) is put off until (2, 0) was expanded through the bottom row with distance 4 instead of 2
+	auto graph = std::make_shared<GridGraph>(8, 2);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(7, 1);
+
+	BestFirstSearch<GridGraph, float, DaryHeap<4>, BumpHeuristic, UnitEdges> bumped(graph, graph->numberOfNodes());
+	bumped.solve();
+	GridAStar<> consistent(graph, graph->numberOfNodes());
+	consistent.solve();
+
+	if (!SearchStatistics::enabled()) {
+		return isZero(bumped.statistics()) && isZero(consistent.statistics());
+	}
+
+	return bumped.statistics().reopenings > 0 && consistent.statistics().reopenings == 0;
+}
+
+bool test_every_strategy_counts_expansions() {
+	auto graph = createCornerToCornerGrid(40, 40, 20, 3);
+
+	bool ok = true;
+	for (ShortestPathAlgorithm algorithm : { ShortestPathAlgorithm::Dijkstra, ShortestPathAlgorithm::AStar, ShortestPathAlgorithm::BidirectionalDijkstra,
+		ShortestPathAlgorithm::BidirectionalAStar, ShortestPathAlgorithm::JumpPointSearch }) {
+		std::unique_ptr<IShortestPathStrategy> search = ShortestPathStrategyFactory::create(algorithm, graph, graph->numberOfNodes());
+		size_t steps = 0;
+		while (search->step() != -1) {
+			++steps;
+		}
+		SearchStatistics statistics = search->statistics();
+
+		if (SearchStatistics::enabled()) {
+			ok = ok && steps > 0 && statistics.expanded == steps && statistics.pops >= steps && statistics.inserts >= statistics.pops &&
+				statistics.generated >= statistics.expanded && statistics.reopenings == 0;
+		}
+		else {
+			ok = ok && isZero(statistics);
+		}
+	}
+
+	return ok;
+}
+
+bool test_sum_keeps_largest_queue() {
+	SearchStatistics first;
+	first.expanded = 10;
+	first.generated = 40;
+	first.inserts = 12;
+	first.pops = 11;
+	first.decreaseKeys = 2;
+	first.maxQueueSize = 7;
+	first.reopenings = 1;
+	first.expansionMilliseconds = 1.5;
+	first.queueMilliseconds = 0.5;
+
+	SearchStatistics second = first;
+	second.maxQueueSize = 3;
+
+	SearchStatistics sum;
+	sum += first;
+	sum += second;
+
+	return sum.expanded == 20 && sum.generated == 80 && sum.inserts == 24 && sum.pops == 22 && sum.decreaseKeys == 4 &&
+		sum.maxQueueSize == 7 && sum.reopenings == 2 && sum.expansionMilliseconds == 3.0 && sum.queueMilliseconds == 1.0;
+}
+
+std::shared_ptr<GridGraph> createCornerToCornerGrid(int width, int height, int obstaclePercent, unsigned int seed) {
+	std::shared_ptr<GridGraph> graph = createRandomObstacles(width, height, obstaclePercent, seed);
+	graph->setBlocked(0, 0, false);
+	graph->setBlocked(width - 1, height - 1, false);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(width - 1, height - 1);
+
+	return graph;
+}
+
+bool isZero(const SearchStatistics& statistics) {
+	return sameCounters(statistics, SearchStatistics()) && statistics.expansionMilliseconds == 0.0 && statistics.queueMilliseconds == 0.0;
+}
+
+bool sameCounters(const SearchStatistics& first, const SearchStatistics& second) {
+	return first.expanded == second.expanded && first.generated == second.generated && first.inserts == second.inserts &&
+		first.pops == second.pops && first.decreaseKeys == second.decreaseKeys && first.maxQueueSize == second.maxQueueSize &&
+		first.reopenings == second.reopenings;
+}
@@ -0,0 +1,224 @@
+#include "AStar.h"
+#include "BidirectionalSearch.h"
+#include "BreadthFirstSearch.h"
+#include "BucketQueue.h"
+#include "DaryHeap.h"
+#include "Dijkstra.h"
+#include "Graph.h"
+#include "GridGraph.h"
+#include "IShortestPathStrategy.h"
+#include "JumpPointSearch.h"
+#include "SearchContext.h"
+#include "TestGrids.h"
+
+#include <assert.h>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_dijkstra_solve_matches_step();
+bool test_astar_solve_matches_step();
+bool test_solve_on_graph_matches_step();
+bool test_other_strategies_solve_same_distance();
+bool test_unreachable_end_has_no_path();
+bool test_start_is_end();
+bool test_finished_search_stays_finished();
+
+// the same search run with step() and with solve() gives the same parents, distance and path
+template<class Strategy, class Graph>
+bool solveMatchesStep(std::shared_ptr<Graph> graph);
+// true if path goes from the start to the end of graph through edges of it
+bool isPathOfGraph(const IGraph& graph, const std::vector<int>& path);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 7;
+
+	TEST(test_dijkstra_solve_matches_step, errCount, okCount);
+	TEST(test_astar_solve_matches_step, errCount, okCount);
+	TEST(test_solve_on_graph_matches_step, errCount, okCount);
+	TEST(test_other_strategies_solve_same_distance, errCount, okCount);
+	TEST(test_unreachable_end_has_no_path, errCount, okCount);
+	TEST(test_start_is_end, errCount, okCount);
+	TEST(test_finished_search_stays_finished, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_dijkstra_solve_matches_step() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 25, seed);
+		ok = solveMatchesStep<Dijkstra<DaryHeap<4>>>(graph) && solveMatchesStep<Dijkstra<BucketQueue>>(graph);
+	}
+
+	return ok;
+}
+
+bool test_astar_solve_matches_step() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 25, seed);
+		ok = solveMatchesStep<AStar<DaryHeap<2>>>(graph) && solveMatchesStep<AStar<BucketQueue>>(graph);
+	}
+
+	return ok;
+}
+
+bool test_solve_on_graph_matches_step() {
+	// not a grid, the searches go through IGraph
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGraph(200, 260, seed);
+		graph->startNode() = 0;
+		graph->endNode() = 199;
+		ok = solveMatchesStep<Dijkstra<DaryHeap<4>>>(graph) && solveMatchesStep<BreadthFirstSearch>(graph);
+	}
+
+	return ok;
+}
+
+bool test_other_strategies_solve_same_distance() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 25, seed);
+		SearchResult expected = Dijkstra<BucketQueue>(graph, graph->numberOfNodes()).solve();
+
+		std::vector<SearchResult> results;
+		results.push_back(BreadthFirstSearch(graph, graph->numberOfNodes()).solve());
+		results.push_back(BidirectionalDijkstra<BucketQueue>(graph, graph->numberOfNodes()).solve());
+		results.push_back(BidirectionalAStar<BucketQueue>(graph, graph->numberOfNodes()).solve());
+		results.push_back(JumpPointSearch(graph, graph->numberOfNodes()).solve());
+
+		for (const SearchResult& result : results) {
+			ok = ok && result.distance == expected.distance && result.path.size() == expected.path.size() &&
+				(result.path.empty() || isPathOfGraph(*graph, result.path));
+		}
+	}
+
+	return ok;
+}
+
+bool test_unreachable_end_has_no_path() {
+	// the end is walled in
+	auto graph = std::make_shared<GridGraph>(5, 5);
+	graph->setBlocked(3, 4, true);
+	graph->setBlocked(4, 3, true);
+	graph->startNode() = graph->index(0, 0);
+	graph->endNode() = graph->index(4, 4);
+
+	SearchResult dijkstra = Dijkstra<>(graph, graph->numberOfNodes()).solve();
+	SearchResult astar = AStar<>(graph, graph->numberOfNodes()).solve();
+	SearchResult breadthFirst = BreadthFirstSearch(graph, graph->numberOfNodes()).solve();
+
+	return dijkstra.distance < 0.0f && dijkstra.path.empty() && astar.distance < 0.0f && astar.path.empty() &&
+		breadthFirst.distance < 0.0f && breadthFirst.path.empty();
+}
+
+bool test_start_is_end() {
+	auto graph = std::make_shared<GridGraph>(5, 5);
+	graph->startNode() = graph->index(2, 2);
+	graph->endNode() = graph->index(2, 2);
+
+	SearchContext<> context(graph->numberOfNodes());
+	SearchResult result = AStar<>(graph, context).solve();
+
+	return result.distance == 0.0f && result.path.size() == 1 && result.path[0] == graph->startNode();
+}
+
+bool test_finished_search_stays_finished() {
+	// once step() returned -1 at the end, the nodes left in the queue are not expanded by later calls
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 10 && ok; ++seed) {
+		auto graph = createRandomGrid(40, 30, 25, seed);
+		int capacity = graph->numberOfNodes();
+
+		std::vector<std::unique_ptr<IShortestPathStrategy>> searches;
+		searches.emplace_back(new Dijkstra<>(graph, capacity));
+		searches.emplace_back(new GridAStar<>(graph, capacity));
+		searches.emplace_back(new OctileAStar<>(graph, capacity));
+		searches.emplace_back(new BreadthFirstSearch(graph, capacity));
+		searches.emplace_back(new BidirectionalAStar<BucketQueue>(graph, capacity));
+		searches.emplace_back(new JumpPointSearch(graph, capacity));
+		searches.emplace_back(new JumpPointSearch(graph, capacity, GridMovement::EightConnected));
+
+		for (auto& search : searches) {
+			while (search->step() != -1) {
+			}
+			std::vector<int> parents = search->parents();
+			SearchResult result = search->solve();
+
+			ok = ok && search->step() == -1 && search->parents() == parents && (result.path.empty() || result.path.back() == graph->endNode());
+		}
+	}
+
+	return ok;
+}
+
+template<class Strategy, class Graph>
+bool solveMatchesStep(std::shared_ptr<Graph> graph) {
+	Strategy stepped(graph, graph->numberOfNodes());
+	std::vector<int> expanded;
+	for (int node = stepped.step(); node != -1; node = stepped.step()) {
+		expanded.push_back(node);
+	}
+
+	Strategy solved(graph, graph->numberOfNodes());
+	SearchResult result = solved.solve();
+
+	// the path of the stepped search, from its parents
+	std::vector<int> path;
+	if (graph->startNode() == graph->endNode() || stepped.parents()[graph->endNode()] >= 0) {
+		for (int node = graph->endNode(); node != graph->startNode(); node = stepped.parents()[node]) {
+			path.insert(path.begin(), node);
+		}
+		path.insert(path.begin(), graph->startNode());
+	}
+
+	float distance = path.empty() ? -1.0f : static_cast<float>(path.size() - 1);
+	return !expanded.empty() && stepped.parents() == solved.parents() && result.path == path && result.distance == distance &&
+		(path.empty() || isPathOfGraph(*graph, path));
+}
+
+bool isPathOfGraph(const IGraph& graph, const std::vector<int>& path) {
+	if (path.empty() || path.front() != graph.startNode() || path.back() != graph.endNode()) {
+		return false;
+	}
+
+	IGraph::NeighborBuffer buffer;
+	for (size_t i = 1; i < path.size(); ++i) {
+		bool adjacent = false;
+		for (int neighbor : graph.neighbors(path[i - 1], buffer)) {
+			adjacent = adjacent || neighbor == path[i];
+		}
+		if (!adjacent) {
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,244 @@
+#include "AStar.h"
+#include "DaryHeap.h"
+#include "Dijkstra.h"
+#include "GridGraph.h"
+#include "IShortestPathStrategy.h"
+#include "Landmarks.h"
+#include "RadixHeap.h"
+#include "SearchPolicies.h"
+#include "ShortestPathStrategyFactory.h"
+
+#include <assert.h>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+/*************  DEFINES  ****************/
+
+#define TEST(func, errCount, okCount) do{\
+										 bool ret = func();\
+										 if(ret){\
+											++okCount;\
+										 }else{\
+											++errCount;\
+										 }\
+										 std::cout << "Test " << #func << (ret ? " OK" : " FAIL") << std::endl;\
+									  }while(false)
+
+/***********  END DEFINES  **************/
+
+/************  FUNCTIONS  ***************/
+
+bool test_new_grid_is_unweighted();
+bool test_set_cost_changes_version_and_weights();
+bool test_weighted_search_goes_around_mud();
+bool test_weighted_searches_match_reference();
+bool test_landmarks_stay_admissible_on_terrain();
+bool test_factory_follows_terrain_costs();
+
+// random obstacles and cells costing 1 to maxCost (at least minCost), start and end clear
+std::shared_ptr<GridGraph> createRandomTerrain(int width, int height, int minCost, int maxCost, unsigned int seed);
+// distances from the start relaxing every edge until nothing changes (-1 when unreachable)
+std::vector<int> referenceDistances(const GridGraph& graph);
+// the path goes from the start to the end over adjacent tiles and its costs add up to distance
+bool isPathWithCost(const GridGraph& graph, const SearchResult& result, int distance);
+
+/**********  END FUNCTIONS  *************/
+
+int main() {
+	int okCount = 0;
+	int errCount = 0;
+	int totalTests = 6;
+
+	TEST(test_new_grid_is_unweighted, errCount, okCount);
+	TEST(test_set_cost_changes_version_and_weights, errCount, okCount);
+	TEST(test_weighted_search_goes_around_mud, errCount, okCount);
+	TEST(test_weighted_searches_match_reference, errCount, okCount);
+	TEST(test_landmarks_stay_admissible_on_terrain, errCount, okCount);
+	TEST(test_factory_follows_terrain_costs, errCount, okCount);
+
+	assert(totalTests == (okCount + errCount));
+
+	std::cout << std::endl;
+	std::cout << "Ok tests: " << okCount << std::endl;
+	std::cout << "Fail tests: " << errCount << std::endl;
+	std::cout << "Total tests: " << totalTests << std::endl;
+}
+
+bool test_new_grid_is_unweighted() {
+	GridGraph graph(6, 4);
+	return graph.hasUniformEdgeWeights() && graph.minimumEdgeWeight() == 1 && graph.cost(5, 3) == 1 &&
+		graph.edgeWeight(graph.index(0, 0), graph.index(1, 0)) == 1;
+}
+
+bool test_set_cost_changes_version_and_weights() {
+	GridGraph graph(3, 2);
+	graph.setCost(1, 1, 5);
+	bool ok = graph.version() == 1 && graph.cost(1, 1) == 5 && !graph.hasUniformEdgeWeights() && graph.minimumEdgeWeight() == 1 &&
+		graph.edgeWeight(graph.index(0, 1), graph.index(1, 1)) == 5 && graph.edgeWeight(graph.index(1, 1), graph.index(0, 1)) == 1;
+
+	// the same cost again is not an edit
+	graph.setCost(1, 1, 5);
+	ok = ok && graph.version() == 1;
+
+	for (int y = 0; y < 2; ++y) {
+		for (int x = 0; x < 3; ++x) {
+			graph.setCost(x, y, x == 1 && y == 1 ? 5 : 2);
+		}
+	}
+	ok = ok && graph.minimumEdgeWeight() == 2 && graph.version() == 6;
+
+	for (int y = 0; y < 2; ++y) {
+		for (int x = 0; x < 3; ++x) {
+			graph.setCost(x, y, 1);
+		}
+	}
+
+	return ok && graph.hasUniformEdgeWeights() && graph.minimumEdgeWeight() == 1;
+}
+
+bool test_weighted_search_goes_around_mud() {
+	// straight through the mud costs 12, around it 6
+	auto graph = std::make_shared<GridGraph>(5, 3);
+	graph->setCost(2, 1, 9);
+	graph->startNode() = graph->index(0, 1);
+	graph->endNode() = graph->index(4, 1);
+
+	SearchResult dijkstra = WeightedDijkstra<RadixHeap>(graph, graph->numberOfNodes()).solve();
+	SearchResult astar = WeightedAStar<DaryHeap<4>, float>(graph, graph->numberOfNodes()).solve();
+
+	return dijkstra.distance == 6.0f && astar.distance == 6.0f && dijkstra.path.size() == 7 &&
+		isPathWithCost(*graph, dijkstra, 6) && isPathWithCost(*graph, astar, 6);
+}
+
+bool test_weighted_searches_match_reference() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 30 && ok; ++seed) {
+		// every third map costs at least 2, so the heuristic is scaled
+		auto graph = createRandomTerrain(30, 20, seed % 3 == 0 ? 2 : 1, 9, seed);
+		int expected = referenceDistances(*graph)[graph->endNode()];
+		int capacity = graph->numberOfNodes();
+
+		SearchResult results[] = {
+			WeightedDijkstra<RadixHeap>(graph, capacity).solve(),
+			WeightedDijkstra<DaryHeap<4>, float>(graph, capacity).solve(),
+			WeightedAStar<RadixHeap>(graph, capacity).solve(),
+			WeightedAStar<DaryHeap<4, uint32_t>>(graph, capacity).solve()
+		};
+		for (const SearchResult& result : results) {
+			ok = ok && (expected < 0 ? result.distance < 0.0f && result.path.empty() : isPathWithCost(*graph, result, expected));
+		}
+	}
+
+	return ok;
+}
+
+bool test_landmarks_stay_admissible_on_terrain() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 20 && ok; ++seed) {
+		auto graph = createRandomTerrain(30, 20, seed % 2 == 0 ? 3 : 1, 6, seed);
+		int expected = referenceDistances(*graph)[graph->endNode()];
+
+		auto landmarks = std::make_shared<Landmarks>(graph, 4);
+		SearchResult result = WeightedAStar<RadixHeap>(graph, graph->numberOfNodes(), ManhattanHeuristic(landmarks)).solve();
+		ok = expected < 0 ? result.path.empty() : isPathWithCost(*graph, result, expected);
+	}
+
+	return ok;
+}
+
+bool test_factory_follows_terrain_costs() {
+	bool ok = true;
+	for (unsigned int seed = 1; seed <= 10 && ok; ++seed) {
+		auto graph = createRandomTerrain(30, 20, 1, 9, seed);
+		int expected = referenceDistances(*graph)[graph->endNode()];
+
+		// the searches that only know unit moves fall back to the weighted ones
+		for (ShortestPathAlgorithm algorithm : { ShortestPathAlgorithm::Dijkstra, ShortestPathAlgorithm::AStar, ShortestPathAlgorithm::BidirectionalDijkstra,
+			ShortestPathAlgorithm::BidirectionalAStar, ShortestPathAlgorithm::JumpPointSearch }) {
+			SearchResult result = ShortestPathStrategyFactory::create(algorithm, graph, graph->numberOfNodes())->solve();
+			ok = ok && (expected < 0 ? result.path.empty() : isPathWithCost(*graph, result, expected));
+		}
+	}
+
+	return ok;
+}
+
+std::shared_ptr<GridGraph> createRandomTerrain(int width, int height, int minCost, int maxCost, unsigned int seed) {
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<int> percent(0, 99);
+	std::uniform_int_distribution<int> cost(minCost, maxCost);
+	std::uniform_int_distribution<int> cell(0, width * height - 1);
+
+	auto graph = std::make_shared<GridGraph>(width, height);
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			graph->setBlocked(x, y, percent(random) < 20);
+			graph->setCost(x, y, percent(random) < 50 ? minCost : cost(random));
+		}
+	}
+
+	graph->startNode() = cell(random);
+	graph->endNode() = cell(random);
+	graph->setBlocked(graph->startNode() % width, graph->startNode() / width, false);
+	graph->setBlocked(graph->endNode() % width, graph->endNode() / width, false);
+
+	return graph;
+}
+
+std::vector<int> referenceDistances(const GridGraph& graph) {
+	const int unreached = std::numeric_limits<int>::max();
+	std::vector<int> distances(graph.numberOfNodes(), unreached);
+	distances[graph.startNode()] = 0;
+
+	IGraph::NeighborBuffer buffer;
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (int node = 0; node < graph.numberOfNodes(); ++node) {
+			if (distances[node] == unreached) {
+				continue;
+			}
+			for (int neighbor : graph.neighbors(node, buffer)) {
+				int distance = distances[node] + graph.cellCost(neighbor);
+				if (distance < distances[neighbor]) {
+					distances[neighbor] = distance;
+					changed = true;
+				}
+			}
+		}
+	}
+
+	for (int& distance : distances) {
+		if (distance == unreached) {
+			distance = -1;
+		}
+	}
+
+	return distances;
+}
+
+bool isPathWithCost(const GridGraph& graph, const SearchResult& result, int distance) {
+	if (result.distance != static_cast<float>(distance) || result.path.empty() ||
+		result.path.front() != graph.startNode() || result.path.back() != graph.endNode()) {
+		return false;
+	}
+
+	IGraph::NeighborBuffer buffer;
+	int cost = 0;
+	for (size_t i = 1; i < result.path.size(); ++i) {
+		bool adjacent = false;
+		for (int neighbor : graph.neighbors(result.path[i - 1], buffer)) {
+			adjacent = adjacent || neighbor == result.path[i];
+		}
+		if (!adjacent) {
+			return false;
+		}
+		cost += graph.cellCost(result.path[i]);
+	}
+
+	return cost == distance;
+}